@@ -0,0 +1,54 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Data/BlueprintEventOverrides.h"
+#include "UObject/Class.h"
+#include "UObject/UObjectGlobals.h"
+
+FBlueprintEventOverrides::FBlueprintEventOverrides(const TArray<FName>& InEventNames)
+	: EventNames(InEventNames)
+{
+	check(EventNames.Num() <= 32);
+
+#if WITH_EDITOR
+	// Recompiling a Blueprint can add or remove overrides, so forget what's been computed
+	ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddLambda([this](const TMap<UObject*, UObject*>&)
+	{
+		ClassOverrides.Reset();
+	});
+#endif
+}
+
+FBlueprintEventOverrides::~FBlueprintEventOverrides()
+{
+#if WITH_EDITOR
+	// Instances are function statics, destroyed when the module is unloaded, e.g. by Live Coding
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+#endif
+}
+
+bool FBlueprintEventOverrides::IsOverridden(const UObject* Object, const int32 EventIndex)
+{
+	const UClass* const Class = Object->GetClass();
+	const uint32* FoundOverrides = ClassOverrides.Find(Class);
+	if (FoundOverrides == nullptr)
+	{
+		FoundOverrides = &ClassOverrides.Add(Class, FindOverriddenEvents(Class));
+	}
+
+	return (*FoundOverrides & (1u << EventIndex)) != 0;
+}
+
+uint32 FBlueprintEventOverrides::FindOverriddenEvents(const UClass* Class) const
+{
+	uint32 Overrides = 0;
+	for (int32 i = 0; i < EventNames.Num(); ++i)
+	{
+		// An event overridden in Blueprint is found in the Blueprint class instead of the native one
+		const UFunction* const Function = Class->FindFunctionByName(EventNames[i]);
+		if (Function != nullptr && !Function->GetOuterUClass()->HasAnyClassFlags(CLASS_Native))
+		{
+			Overrides |= 1u << i;
+		}
+	}
+	return Overrides;
+}
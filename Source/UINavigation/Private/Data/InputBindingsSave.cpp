@@ -0,0 +1,108 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Data/InputBindingsSave.h"
+#include "Data/SharedInputModifiers.h"
+#include "InputModifiers.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+const uint32 FInputBindingsSave::Magic = 0x424E4955;
+const uint16 FInputBindingsSave::Version = 1;
+
+FArchive& operator<<(FArchive& Ar, FSavedInputModifier& Modifier)
+{
+	uint8 Type = static_cast<uint8>(Modifier.Type);
+	Ar << Type;
+	Ar << Modifier.Value;
+	Modifier.Type = static_cast<ESavedInputModifierType>(Type);
+	return Ar;
+}
+
+UInputModifier* FSavedInputModifier::GetModifier() const
+{
+	if (Type == ESavedInputModifierType::Negate)
+	{
+		return USharedInputModifiers::GetNegateModifier((Value & 1) != 0, (Value & 2) != 0, (Value & 4) != 0);
+	}
+
+	return USharedInputModifiers::GetSwizzleModifier(static_cast<EInputAxisSwizzle>(Value));
+}
+
+void FSavedInputMapping::AddModifier(const UInputModifier* Modifier)
+{
+	if (const UInputModifierNegate* const NegateModifier = Cast<UInputModifierNegate>(Modifier))
+	{
+		FSavedInputModifier& SavedModifier = Modifiers.AddDefaulted_GetRef();
+		SavedModifier.Type = ESavedInputModifierType::Negate;
+		SavedModifier.Value = (NegateModifier->bX ? 1 : 0) | (NegateModifier->bY ? 2 : 0) | (NegateModifier->bZ ? 4 : 0);
+	}
+	else if (const UInputModifierSwizzleAxis* const SwizzleModifier = Cast<UInputModifierSwizzleAxis>(Modifier))
+	{
+		FSavedInputModifier& SavedModifier = Modifiers.AddDefaulted_GetRef();
+		SavedModifier.Type = ESavedInputModifierType::Swizzle;
+		SavedModifier.Value = static_cast<uint8>(SwizzleModifier->Order);
+	}
+}
+
+FArchive& operator<<(FArchive& Ar, FSavedInputMapping& Mapping)
+{
+	// Keys are saved by name so that the file doesn't depend on the FName table
+	FString KeyName = Mapping.Key.ToString();
+	Ar << KeyName;
+	Mapping.Key = FName(*KeyName);
+
+	uint8 NumModifiers = static_cast<uint8>(FMath::Min(Mapping.Modifiers.Num(), MAX_uint8));
+	Ar << NumModifiers;
+	Mapping.Modifiers.SetNum(NumModifiers);
+	for (FSavedInputModifier& Modifier : Mapping.Modifiers)
+	{
+		Ar << Modifier;
+	}
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FSavedActionBindings& ActionBindings)
+{
+	Ar << ActionBindings.ContextPath;
+	Ar << ActionBindings.ActionPath;
+	Ar << ActionBindings.Mappings;
+	return Ar;
+}
+
+void SerializeInputBindings(const FInputBindingsSave& BindingsSave, TArray<uint8>& OutBytes)
+{
+	OutBytes.Reset();
+	FMemoryWriter Writer(OutBytes);
+
+	uint32 SavedMagic = FInputBindingsSave::Magic;
+	uint16 SavedVersion = FInputBindingsSave::Version;
+	Writer << SavedMagic;
+	Writer << SavedVersion;
+
+	// Archive operators take non-const references, but a writer doesn't modify what it writes
+	Writer << const_cast<TArray<FSavedActionBindings>&>(BindingsSave.Actions);
+}
+
+bool DeserializeInputBindings(const TArray<uint8>& Bytes, FInputBindingsSave& OutBindingsSave)
+{
+	OutBindingsSave.Actions.Reset();
+	FMemoryReader Reader(Bytes);
+
+	uint32 SavedMagic = 0;
+	uint16 SavedVersion = 0;
+	Reader << SavedMagic;
+	Reader << SavedVersion;
+	if (Reader.IsError() || SavedMagic != FInputBindingsSave::Magic || SavedVersion == 0 || SavedVersion > FInputBindingsSave::Version)
+	{
+		return false;
+	}
+
+	Reader << OutBindingsSave.Actions;
+	if (Reader.IsError())
+	{
+		OutBindingsSave.Actions.Reset();
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,57 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Data/MappingContextSnapshot.h"
+#include "InputModifiers.h"
+#include "InputTriggers.h"
+#include "UObject/UnrealType.h"
+
+static bool InstancesMatch(const UObject* const Instance, const UObject* const Other)
+{
+	if (Instance == Other)
+	{
+		return true;
+	}
+
+	if (Instance == nullptr || Other == nullptr || Instance->GetClass() != Other->GetClass())
+	{
+		return false;
+	}
+
+	// Transient properties hold runtime state, such as a trigger's last value, rather than configuration
+	for (TFieldIterator<FProperty> It(Instance->GetClass()); It; ++It)
+	{
+		if (!It->HasAnyPropertyFlags(CPF_Transient) && !It->Identical_InContainer(Instance, Other))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <typename T>
+static bool InstanceArraysMatch(const TArray<TObjectPtr<T>>& Instances, const TArray<TObjectPtr<T>>& Others)
+{
+	if (Instances.Num() != Others.Num())
+	{
+		return false;
+	}
+
+	for (int32 i = 0; i < Instances.Num(); ++i)
+	{
+		if (!InstancesMatch(Instances[i], Others[i]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FMappingContextSnapshot::MappingsMatch(const FEnhancedActionKeyMapping& Mapping, const FEnhancedActionKeyMapping& Other)
+{
+	return Mapping.Action == Other.Action &&
+		Mapping.Key == Other.Key &&
+		InstanceArraysMatch(Mapping.Modifiers, Other.Modifiers) &&
+		InstanceArraysMatch(Mapping.Triggers, Other.Triggers);
+}
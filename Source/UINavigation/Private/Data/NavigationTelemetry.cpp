@@ -0,0 +1,45 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Data/NavigationTelemetry.h"
+#include "HAL/PlatformTime.h"
+
+FString FNavigationTelemetryRecord::ToString() const
+{
+	static const TCHAR* const EventNames[] =
+	{
+		TEXT("Navigated"),
+		TEXT("WidgetOpened"),
+		TEXT("ReturnedToParent"),
+		TEXT("InputTypeChanged"),
+		TEXT("KeyRebound"),
+	};
+
+	return FString::Printf(TEXT("%.6f,%s,%s,%d,%d,%d"),
+		FPlatformTime::ToSeconds64(Cycles),
+		EventNames[static_cast<uint8>(Event)],
+		*Subject.ToString(),
+		Value,
+		FromInputType,
+		ToInputType);
+}
+
+FNavigationTelemetryBuffer::FNavigationTelemetryBuffer(const uint32 InCapacity)
+{
+	const uint32 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max(InCapacity, 2u));
+	Records.SetNum(Capacity);
+	Mask = Capacity - 1;
+}
+
+int32 FNavigationTelemetryBuffer::Drain(TFunctionRef<void(const FNavigationTelemetryRecord&)> Callback)
+{
+	const uint32 CurrentTail = Tail.load(std::memory_order_relaxed);
+	const uint32 CurrentHead = Head.load(std::memory_order_acquire);
+
+	for (uint32 i = CurrentTail; i != CurrentHead; ++i)
+	{
+		Callback(Records[i & Mask]);
+	}
+
+	Tail.store(CurrentHead, std::memory_order_release);
+	return static_cast<int32>(CurrentHead - CurrentTail);
+}
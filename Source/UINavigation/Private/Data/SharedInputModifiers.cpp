@@ -0,0 +1,48 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Data/SharedInputModifiers.h"
+
+USharedInputModifiers* USharedInputModifiers::Get()
+{
+	static USharedInputModifiers* Instance = nullptr;
+	if (Instance == nullptr)
+	{
+		Instance = NewObject<USharedInputModifiers>();
+		Instance->AddToRoot();
+	}
+
+	return Instance;
+}
+
+UInputModifierNegate* USharedInputModifiers::GetNegateModifier(const bool bX, const bool bY, const bool bZ)
+{
+	USharedInputModifiers* const SharedModifiers = Get();
+	UInputModifierNegate*& NegateModifier = SharedModifiers->NegateModifiers[(bX ? 1 : 0) | (bY ? 2 : 0) | (bZ ? 4 : 0)];
+	if (NegateModifier == nullptr)
+	{
+		NegateModifier = NewObject<UInputModifierNegate>(SharedModifiers);
+		NegateModifier->bX = bX;
+		NegateModifier->bY = bY;
+		NegateModifier->bZ = bZ;
+	}
+
+	return NegateModifier;
+}
+
+UInputModifierSwizzleAxis* USharedInputModifiers::GetSwizzleModifier(const EInputAxisSwizzle Order)
+{
+	if (static_cast<uint8>(Order) >= UE_ARRAY_COUNT(SwizzleModifiers))
+	{
+		return nullptr;
+	}
+
+	USharedInputModifiers* const SharedModifiers = Get();
+	UInputModifierSwizzleAxis*& SwizzleModifier = SharedModifiers->SwizzleModifiers[static_cast<uint8>(Order)];
+	if (SwizzleModifier == nullptr)
+	{
+		SwizzleModifier = NewObject<UInputModifierSwizzleAxis>(SharedModifiers);
+		SwizzleModifier->Order = Order;
+	}
+
+	return SwizzleModifier;
+}
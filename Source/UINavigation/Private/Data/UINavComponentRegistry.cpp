@@ -0,0 +1,100 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Data/UINavComponentRegistry.h"
+#include "UINavComponent.h"
+
+void FUINavComponentRegistry::Add(UUINavComponent* Component, UUINavWidget* Owner)
+{
+	Component->RegistryOwner = Owner;
+	Component->RegistryIndex = Components.Add(Component);
+	NavigableFlags.Add(Component->CanBeNavigated());
+	RegistrationOrders.Add(NextRegistrationOrder++);
+}
+
+void FUINavComponentRegistry::Remove(UUINavComponent* Component)
+{
+	const int32 Index = Component->RegistryIndex;
+	if (!Components.IsValidIndex(Index) || Components[Index] != Component)
+	{
+		return;
+	}
+
+	Components.RemoveAtSwap(Index, 1, false);
+	NavigableFlags.RemoveAtSwap(Index, 1, false);
+	RegistrationOrders.RemoveAtSwap(Index, 1, false);
+	if (Components.IsValidIndex(Index) && IsValid(Components[Index]))
+	{
+		Components[Index]->RegistryIndex = Index;
+	}
+
+	Component->RegistryOwner = nullptr;
+	Component->RegistryIndex = INDEX_NONE;
+}
+
+void FUINavComponentRegistry::Append(FUINavComponentRegistry& Other, UUINavWidget* Owner)
+{
+	// The other registry's components are registered after this one's, keeping their relative order
+	TArray<int32> OtherIndices;
+	OtherIndices.Reserve(Other.Num());
+	for (int32 i = 0; i < Other.Num(); ++i)
+	{
+		OtherIndices.Add(i);
+	}
+	OtherIndices.Sort([&Other](const int32 A, const int32 B)
+	{
+		return Other.RegistrationOrders[A] < Other.RegistrationOrders[B];
+	});
+
+	const int32 FirstIndex = Components.Num();
+	for (const int32 OtherIndex : OtherIndices)
+	{
+		Components.Add(Other.Components[OtherIndex]);
+		NavigableFlags.Add(Other.NavigableFlags[OtherIndex]);
+		RegistrationOrders.Add(NextRegistrationOrder++);
+	}
+
+	for (int32 i = FirstIndex; i < Components.Num(); ++i)
+	{
+		if (!IsValid(Components[i])) continue;
+		Components[i]->RegistryOwner = Owner;
+		Components[i]->RegistryIndex = i;
+	}
+
+	Other.Components.Reset();
+	Other.NavigableFlags.Reset();
+	Other.RegistrationOrders.Reset();
+	Other.NextRegistrationOrder = 0;
+}
+
+void FUINavComponentRegistry::Reset()
+{
+	for (UUINavComponent* const Component : Components)
+	{
+		if (IsValid(Component))
+		{
+			Component->RegistryOwner = nullptr;
+			Component->RegistryIndex = INDEX_NONE;
+		}
+	}
+
+	Components.Reset();
+	NavigableFlags.Reset();
+	RegistrationOrders.Reset();
+	NextRegistrationOrder = 0;
+}
+
+UUINavComponent* FUINavComponentRegistry::FindFirstNavigable() const
+{
+	// Components are swapped out when removed, so the array order says nothing about which one came first
+	int32 FirstIndex = INDEX_NONE;
+	for (int32 i = 0; i < NavigableFlags.Num(); ++i)
+	{
+		if (NavigableFlags[i] && (FirstIndex == INDEX_NONE || RegistrationOrders[i] < RegistrationOrders[FirstIndex]) &&
+			IsValid(Components[i]))
+		{
+			FirstIndex = i;
+		}
+	}
+
+	return FirstIndex != INDEX_NONE ? Components[FirstIndex] : nullptr;
+}
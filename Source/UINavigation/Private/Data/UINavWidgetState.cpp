@@ -0,0 +1,15 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Data/UINavWidgetState.h"
+
+FArchive& operator<<(FArchive& Ar, FUINavWidgetState& State)
+{
+	Ar << State.FocusedWidgetIndex;
+	Ar << State.CurrentComponentIndices;
+	Ar << State.ScrollOffsets;
+	Ar << State.HorizontalComponentValues;
+	Ar << State.BuiltLazyWidgets;
+	Ar << State.SelectorPosition;
+	Ar << State.bHasSelectorPosition;
+	return Ar;
+}
@@ -0,0 +1,124 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Data/InputBindingsSave.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace UINavInputBindingsSaveTest
+{
+	static FInputBindingsSave MakeSave()
+	{
+		FInputBindingsSave BindingsSave;
+
+		FSavedActionBindings& MoveBindings = BindingsSave.Actions.AddDefaulted_GetRef();
+		MoveBindings.ContextPath = TEXT("/Game/Input/IMC_Default.IMC_Default");
+		MoveBindings.ActionPath = TEXT("/Game/Input/IA_Move.IA_Move");
+
+		FSavedInputMapping& UpMapping = MoveBindings.Mappings.Add_GetRef(FSavedInputMapping(TEXT("W")));
+		FSavedInputModifier& SwizzleModifier = UpMapping.Modifiers.AddDefaulted_GetRef();
+		SwizzleModifier.Type = ESavedInputModifierType::Swizzle;
+		SwizzleModifier.Value = 1;
+
+		FSavedInputMapping& DownMapping = MoveBindings.Mappings.Add_GetRef(FSavedInputMapping(TEXT("S")));
+		FSavedInputModifier& NegateModifier = DownMapping.Modifiers.AddDefaulted_GetRef();
+		NegateModifier.Type = ESavedInputModifierType::Negate;
+		NegateModifier.Value = 2;
+		DownMapping.Modifiers.Add(SwizzleModifier);
+
+		MoveBindings.Mappings.Add(FSavedInputMapping(TEXT("Gamepad_Left2D")));
+
+		FSavedActionBindings& JumpBindings = BindingsSave.Actions.AddDefaulted_GetRef();
+		JumpBindings.ContextPath = MoveBindings.ContextPath;
+		JumpBindings.ActionPath = TEXT("/Game/Input/IA_Jump.IA_Jump");
+		JumpBindings.Mappings.Add(FSavedInputMapping(TEXT("SpaceBar")));
+
+		// An action whose every mapping was removed
+		FSavedActionBindings& CrouchBindings = BindingsSave.Actions.AddDefaulted_GetRef();
+		CrouchBindings.ContextPath = MoveBindings.ContextPath;
+		CrouchBindings.ActionPath = TEXT("/Game/Input/IA_Crouch.IA_Crouch");
+
+		return BindingsSave;
+	}
+
+	// Overwrites the header's version, which follows the 4 byte magic value
+	static void SetSavedVersion(TArray<uint8>& Bytes, uint16 NewVersion)
+	{
+		TArray<uint8> VersionBytes;
+		FMemoryWriter Writer(VersionBytes);
+		Writer << NewVersion;
+		FMemory::Memcpy(Bytes.GetData() + sizeof(uint32), VersionBytes.GetData(), VersionBytes.Num());
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUINavInputBindingsSaveTest, "UINavigation.Rebinding.BindingsSave", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUINavInputBindingsSaveTest::RunTest(const FString& Parameters)
+{
+	using namespace UINavInputBindingsSaveTest;
+
+	const FInputBindingsSave BindingsSave = MakeSave();
+	TArray<uint8> Bytes;
+	SerializeInputBindings(BindingsSave, Bytes);
+
+	// Round trip
+	{
+		FInputBindingsSave LoadedSave;
+		if (TestTrue(TEXT("Deserializing a written save succeeds"), DeserializeInputBindings(Bytes, LoadedSave)) &&
+			TestEqual(TEXT("Number of saved actions"), LoadedSave.Actions.Num(), BindingsSave.Actions.Num()))
+		{
+			for (int32 i = 0; i < BindingsSave.Actions.Num(); ++i)
+			{
+				const FSavedActionBindings& Expected = BindingsSave.Actions[i];
+				const FSavedActionBindings& Loaded = LoadedSave.Actions[i];
+				TestEqual(TEXT("Context path"), Loaded.ContextPath, Expected.ContextPath);
+				TestEqual(TEXT("Action path"), Loaded.ActionPath, Expected.ActionPath);
+				TestTrue(FString::Printf(TEXT("Mappings and modifiers of %s"), *Expected.ActionPath), Loaded.Mappings == Expected.Mappings);
+			}
+		}
+
+		TArray<uint8> RewrittenBytes;
+		SerializeInputBindings(LoadedSave, RewrittenBytes);
+		TestTrue(TEXT("Rewriting a loaded save produces the same bytes"), RewrittenBytes == Bytes);
+	}
+
+	// Wrong magic value
+	{
+		TArray<uint8> BadBytes = Bytes;
+		BadBytes[0] ^= 0xFF;
+		FInputBindingsSave LoadedSave;
+		TestFalse(TEXT("Deserializing data with a wrong magic value fails"), DeserializeInputBindings(BadBytes, LoadedSave));
+		TestEqual(TEXT("Actions loaded from data with a wrong magic value"), LoadedSave.Actions.Num(), 0);
+	}
+
+	// Newer and invalid versions
+	{
+		TArray<uint8> NewerBytes = Bytes;
+		SetSavedVersion(NewerBytes, FInputBindingsSave::Version + 1);
+		FInputBindingsSave LoadedSave;
+		TestFalse(TEXT("Deserializing a save of a newer version fails"), DeserializeInputBindings(NewerBytes, LoadedSave));
+		TestEqual(TEXT("Actions loaded from a save of a newer version"), LoadedSave.Actions.Num(), 0);
+
+		TArray<uint8> ZeroVersionBytes = Bytes;
+		SetSavedVersion(ZeroVersionBytes, 0);
+		TestFalse(TEXT("Deserializing a save of version 0 fails"), DeserializeInputBindings(ZeroVersionBytes, LoadedSave));
+	}
+
+	// Truncated data, including an empty array and a partial header
+	for (int32 NumBytes = 0; NumBytes < Bytes.Num(); ++NumBytes)
+	{
+		const TArray<uint8> TruncatedBytes(Bytes.GetData(), NumBytes);
+		FInputBindingsSave LoadedSave;
+		if (!TestFalse(FString::Printf(TEXT("Deserializing a save truncated to %d of %d bytes fails"), NumBytes, Bytes.Num()), DeserializeInputBindings(TruncatedBytes, LoadedSave)))
+		{
+			break;
+		}
+		TestEqual(TEXT("Actions loaded from a truncated save"), LoadedSave.Actions.Num(), 0);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,84 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "HAL/PlatformTime.h"
+#include "InputMappingContext.h"
+#include "UINavPCComponent.h"
+
+namespace UINavInputContextsBenchmark
+{
+	// How CacheGameInputContexts used to find and load every input context in the project, on the game thread
+	static int32 CacheInputContextsSynchronously()
+	{
+		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+		TArray<FAssetData> AssetsData;
+		AssetRegistryModule.Get().GetAssetsByClass(UInputMappingContext::StaticClass()->GetClassPathName(), AssetsData);
+
+		int32 NumContexts = 0;
+		for (const FAssetData& AssetData : AssetsData)
+		{
+			if (IsValid(Cast<UInputMappingContext>(AssetData.GetAsset())))
+			{
+				++NumContexts;
+			}
+		}
+		return NumContexts;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUINavInputContextsBenchmark, "UINavigation.Benchmarks.InputContextsStartup", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FUINavInputContextsBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace UINavInputContextsBenchmark;
+
+	// The asynchronous path runs first, so that it's the one that pays for any context that isn't loaded yet
+	const double RequestStartTime = FPlatformTime::Seconds();
+	TArray<FSoftObjectPath> ContextPaths;
+	UUINavPCComponent::GatherInputContextPaths(ContextPaths);
+
+	int32 NumLoadedContexts = 0;
+	for (const FSoftObjectPath& ContextPath : ContextPaths)
+	{
+		NumLoadedContexts += ContextPath.ResolveObject() != nullptr ? 1 : 0;
+	}
+
+	const TSharedPtr<FStreamableHandle> LoadHandle = ContextPaths.Num() > 0 ?
+		UAssetManager::GetStreamableManager().RequestAsyncLoad(ContextPaths, FStreamableDelegate()) :
+		nullptr;
+	const double RequestTime = FPlatformTime::Seconds() - RequestStartTime;
+
+	if (LoadHandle.IsValid())
+	{
+		LoadHandle->WaitUntilComplete();
+	}
+	const double AsyncTotalTime = FPlatformTime::Seconds() - RequestStartTime;
+
+	const double SyncStartTime = FPlatformTime::Seconds();
+	const int32 NumSyncContexts = CacheInputContextsSynchronously();
+	const double SyncTime = FPlatformTime::Seconds() - SyncStartTime;
+
+	AddInfo(FString::Printf(TEXT("Asynchronous caching: %d contexts, %.2f ms on the game thread to request them, %.2f ms until they finished loading"),
+		ContextPaths.Num(), RequestTime * 1000.0, AsyncTotalTime * 1000.0));
+	AddInfo(FString::Printf(TEXT("Synchronous caching: %d contexts, %.2f ms on the game thread"), NumSyncContexts, SyncTime * 1000.0));
+
+	if (NumLoadedContexts > 0)
+	{
+		// Contexts loaded by the running game or editor don't go to disk, so these times are lower than on a cold start
+		AddInfo(FString::Printf(TEXT("%d of the %d contexts were already loaded"), NumLoadedContexts, ContextPaths.Num()));
+	}
+
+	if (LoadHandle.IsValid())
+	{
+		LoadHandle->ReleaseHandle();
+	}
+	return true;
+}
+
+#endif
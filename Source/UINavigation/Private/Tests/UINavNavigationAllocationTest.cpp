@@ -0,0 +1,65 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Tests/UINavTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUINavNavigationAllocationTest, "UINavigation.Navigation.NoAllocations", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FUINavNavigationAllocationTest::RunTest(const FString& Parameters)
+{
+	using namespace UINavTests;
+
+	UUINavPCComponent* const UINavPC = GetUINavPC(*this);
+	if (UINavPC == nullptr)
+	{
+		return false;
+	}
+
+	// Navigation alternates between an outer widget and a nested one, so that it also goes through
+	// the active widget changes and the focus propagation between them
+	TArray<UUINavComponent*> OuterComponents;
+	TArray<UUINavComponent*> NestedComponents;
+	UUINavWidget* const Widget = CreateTestWidget(UINavPC->GetPC(), 4, OuterComponents);
+	CreateNestedTestWidget(Widget, 4, NestedComponents);
+	UINavPC->GoToBuiltWidget(Widget, false);
+
+	TArray<UUINavComponent*> Path;
+	for (int32 i = 0; i < OuterComponents.Num(); ++i)
+	{
+		Path.Add(OuterComponents[i]);
+		Path.Add(NestedComponents[i]);
+	}
+	Path.Append(OuterComponents);
+	Path.Append(NestedComponents);
+
+	const auto NavigatePath = [&Path]()
+	{
+		for (UUINavComponent* const Component : Path)
+		{
+			Component->ParentWidget->NavigatedTo(Component);
+		}
+	};
+
+	// The first navigations fill the per-class and per-widget caches
+	NavigatePath();
+	NavigatePath();
+
+	const int32 NumPasses = 100;
+	int32 NumAllocations = 0;
+	{
+		FScopedAllocationCounter AllocationCounter;
+		for (int32 i = 0; i < NumPasses; ++i)
+		{
+			NavigatePath();
+		}
+		NumAllocations = AllocationCounter.GetNumAllocations();
+	}
+
+	TestEqual(FString::Printf(TEXT("Heap allocations over %d navigations"), NumPasses * Path.Num()), NumAllocations, 0);
+
+	Widget->RemoveFromParent();
+	return true;
+}
+
+#endif
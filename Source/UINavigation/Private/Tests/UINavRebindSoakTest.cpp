@@ -0,0 +1,110 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Data/InputBindingsSave.h"
+#include "Data/SharedInputModifiers.h"
+#include "HAL/PlatformMemory.h"
+#include "InputAction.h"
+#include "InputCoreTypes.h"
+#include "InputMappingContext.h"
+#include "InputModifiers.h"
+#include "UINavInputBox.h"
+#include "UObject/UObjectIterator.h"
+
+namespace UINavRebindSoakTest
+{
+	static const int32 NumRebinds = 10000;
+	// Allocator slack and other threads make the process' memory noisy, so only growth beyond this counts as a leak
+	static const uint64 MaxMemoryGrowth = 4 * 1024 * 1024;
+
+	static int32 CountInputModifiers()
+	{
+		int32 NumModifiers = 0;
+		for (TObjectIterator<UInputModifier> It; It; ++It)
+		{
+			++NumModifiers;
+		}
+		return NumModifiers;
+	}
+
+	// Rebinds the action's only mapping the same way the input box does for a positive or negative axis box
+	static void Rebind(UInputMappingContext* InputContext, const FInputContainerEnhancedActionData& ActionData, const FKey& NewKey, const int32 Iteration)
+	{
+		InputContext->UnmapAllKeysFromAction(ActionData.Action);
+		FEnhancedActionKeyMapping& NewMapping = InputContext->MapKey(ActionData.Action, NewKey);
+		UUINavInputBox::AddRelevantModifiers(ActionData, NewMapping);
+		UUINavInputBox::ApplyNegateModifiers(ActionData, NewMapping, (Iteration & 1) != 0, (Iteration & 2) != 0, (Iteration & 4) != 0);
+
+		// Saved bindings resolve back into the same shared modifiers
+		FSavedInputMapping SavedMapping(NewMapping.Key.GetFName());
+		for (const UInputModifier* const Modifier : NewMapping.Modifiers)
+		{
+			SavedMapping.AddModifier(Modifier);
+		}
+		NewMapping.Modifiers.Reset();
+		for (const FSavedInputModifier& SavedModifier : SavedMapping.Modifiers)
+		{
+			NewMapping.Modifiers.Add(SavedModifier.GetModifier());
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUINavRebindSoakTest, "UINavigation.Rebinding.Soak", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUINavRebindSoakTest::RunTest(const FString& Parameters)
+{
+	using namespace UINavRebindSoakTest;
+
+	UInputMappingContext* const InputContext = NewObject<UInputMappingContext>(GetTransientPackage());
+	UInputAction* const Action = NewObject<UInputAction>(GetTransientPackage());
+	Action->ValueType = EInputActionValueType::Axis3D;
+	InputContext->AddToRoot();
+	Action->AddToRoot();
+
+	const FKey Keys[] = { EKeys::W, EKeys::S, EKeys::Gamepad_LeftY, EKeys::Gamepad_RightX };
+	const EInputAxis Axes[] = { EInputAxis::X, EInputAxis::Y, EInputAxis::Z };
+	const EAxisType AxisScales[] = { EAxisType::Positive, EAxisType::Negative };
+
+	FInputContainerEnhancedActionData ActionData;
+	ActionData.Action = Action;
+
+	// Creates every shared modifier, so that the measurements below only see what rebinding itself allocates
+	for (int32 i = 0; i < 64; ++i)
+	{
+		ActionData.Axis = Axes[i % UE_ARRAY_COUNT(Axes)];
+		ActionData.AxisScale = AxisScales[(i / 8) % UE_ARRAY_COUNT(AxisScales)];
+		Rebind(InputContext, ActionData, Keys[i % UE_ARRAY_COUNT(Keys)], i);
+	}
+	for (int32 i = 0; i < 6; ++i)
+	{
+		USharedInputModifiers::GetSwizzleModifier(static_cast<EInputAxisSwizzle>(i));
+	}
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	const int32 StartModifiers = CountInputModifiers();
+	const uint64 StartMemory = FPlatformMemory::GetStats().UsedPhysical;
+
+	for (int32 i = 0; i < NumRebinds; ++i)
+	{
+		ActionData.Axis = Axes[i % UE_ARRAY_COUNT(Axes)];
+		ActionData.AxisScale = AxisScales[(i / 8) % UE_ARRAY_COUNT(AxisScales)];
+		Rebind(InputContext, ActionData, Keys[i % UE_ARRAY_COUNT(Keys)], i);
+	}
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	const int32 EndModifiers = CountInputModifiers();
+	const uint64 EndMemory = FPlatformMemory::GetStats().UsedPhysical;
+
+	TestEqual(TEXT("Input modifier objects after rebinding"), EndModifiers, StartModifiers);
+	TestTrue(FString::Printf(TEXT("Memory grew by %llu bytes over %d rebinds"), EndMemory > StartMemory ? EndMemory - StartMemory : 0, NumRebinds),
+		EndMemory <= StartMemory + MaxMemoryGrowth);
+
+	InputContext->RemoveFromRoot();
+	Action->RemoveFromRoot();
+	return true;
+}
+
+#endif
@@ -0,0 +1,197 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Blueprint/WidgetTree.h"
+#include "Components/Button.h"
+#include "Components/VerticalBox.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/MemoryBase.h"
+#include "UINavComponent.h"
+#include "UINavPCComponent.h"
+#include "UINavWidget.h"
+
+/**
+*	Helpers for the tests that need a running game, a player controller with a UINavPCComponent
+*	and UINav widgets. The widgets are built in code, so the tests don't depend on any project assets.
+*/
+namespace UINavTests
+{
+	inline APlayerController* FindLocalPlayerController()
+	{
+		if (GEngine == nullptr)
+		{
+			return nullptr;
+		}
+
+		for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+		{
+			UWorld* const World = WorldContext.World();
+			if (World == nullptr || (WorldContext.WorldType != EWorldType::Game && WorldContext.WorldType != EWorldType::PIE))
+			{
+				continue;
+			}
+
+			APlayerController* const PC = World->GetFirstPlayerController();
+			if (IsValid(PC) && PC->IsLocalController())
+			{
+				return PC;
+			}
+		}
+
+		return nullptr;
+	}
+
+	// Returns the UINavPCComponent of the first local player, or nullptr after reporting why there's none
+	inline UUINavPCComponent* GetUINavPC(FAutomationTestBase& Test)
+	{
+		APlayerController* const PC = FindLocalPlayerController();
+		if (PC == nullptr)
+		{
+			Test.AddError(TEXT("This test needs a game or PIE session with a local player controller"));
+			return nullptr;
+		}
+
+		UUINavPCComponent* const UINavPC = PC->FindComponentByClass<UUINavPCComponent>();
+		if (UINavPC == nullptr)
+		{
+			Test.AddError(FString::Printf(TEXT("%s doesn't have a UINavPCComponent"), *PC->GetName()));
+		}
+		return UINavPC;
+	}
+
+	// Creates a component made of a single button, owned by the given widget
+	inline UUINavComponent* CreateComponent(UUINavWidget* Widget)
+	{
+		UUINavComponent* const Component = Widget->WidgetTree->ConstructWidget<UUINavComponent>(UUINavComponent::StaticClass());
+		UButton* const Button = Component->WidgetTree->ConstructWidget<UButton>(UButton::StaticClass());
+		Component->WidgetTree->RootWidget = Button;
+		Component->NavButton = Button;
+		return Component;
+	}
+
+	// Adds a component made of a single button to the given widget's panel
+	inline UUINavComponent* AddComponent(UUINavWidget* Widget, UPanelWidget* Panel)
+	{
+		UUINavComponent* const Component = CreateComponent(Widget);
+		Panel->AddChild(Component);
+		return Component;
+	}
+
+	// Creates a UINav widget with a vertical box as its root, holding the given number of components
+	inline UUINavWidget* CreateTestWidget(APlayerController* PC, const int32 NumComponents, TArray<UUINavComponent*>& OutComponents)
+	{
+		UUINavWidget* const Widget = ::CreateWidget<UUINavWidget>(PC, UUINavWidget::StaticClass());
+		UVerticalBox* const Panel = Widget->WidgetTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass());
+		Widget->WidgetTree->RootWidget = Panel;
+
+		for (int32 i = 0; i < NumComponents; ++i)
+		{
+			OutComponents.Add(AddComponent(Widget, Panel));
+		}
+		return Widget;
+	}
+
+	// Creates a UINav widget nested in the given widget's root panel, holding the given number of components
+	inline UUINavWidget* CreateNestedTestWidget(UUINavWidget* OuterWidget, const int32 NumComponents, TArray<UUINavComponent*>& OutComponents)
+	{
+		UUINavWidget* const Widget = OuterWidget->WidgetTree->ConstructWidget<UUINavWidget>(UUINavWidget::StaticClass());
+		UVerticalBox* const Panel = Widget->WidgetTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass());
+		Widget->WidgetTree->RootWidget = Panel;
+		CastChecked<UPanelWidget>(OuterWidget->WidgetTree->RootWidget)->AddChild(Widget);
+
+		for (int32 i = 0; i < NumComponents; ++i)
+		{
+			OutComponents.Add(AddComponent(Widget, Panel));
+		}
+		return Widget;
+	}
+
+	/**
+	*	Counts the heap allocations made on the game thread while it's alive, by standing in for GMalloc
+	*	and forwarding every call to the allocator it replaced.
+	*/
+	class FScopedAllocationCounter : public FMalloc
+	{
+	public:
+
+		FScopedAllocationCounter()
+			: InnerMalloc(GMalloc)
+		{
+			GMalloc = this;
+		}
+
+		virtual ~FScopedAllocationCounter() override
+		{
+			GMalloc = InnerMalloc;
+		}
+
+		FORCEINLINE int32 GetNumAllocations() const { return NumAllocations; }
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return InnerMalloc->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return InnerMalloc->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				CountAllocation();
+			}
+			return InnerMalloc->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				CountAllocation();
+			}
+			return InnerMalloc->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Count, Alignment); }
+		virtual void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { InnerMalloc->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void UpdateStats() override { InnerMalloc->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { InnerMalloc->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { InnerMalloc->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return InnerMalloc->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return InnerMalloc->GetDescriptiveName(); }
+
+	private:
+
+		FORCEINLINE void CountAllocation()
+		{
+			// Other threads keep allocating for their own work during the test
+			if (IsInGameThread())
+			{
+				++NumAllocations;
+			}
+		}
+
+		FMalloc* InnerMalloc = nullptr;
+
+		int32 NumAllocations = 0;
+	};
+}
+
+#endif
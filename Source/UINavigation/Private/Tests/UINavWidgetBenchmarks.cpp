@@ -0,0 +1,172 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Tests/UINavTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/PlatformTime.h"
+
+namespace UINavWidgetBenchmarks
+{
+	// How NativeOnFocusChanging classified focused widget types before their names were cached
+	static bool IsFocusableWidgetTypeUncached(const FName WidgetType)
+	{
+		const FString WidgetTypeString = WidgetType.ToString();
+		return WidgetTypeString.Contains(TEXT("SObjectWidget")) ||
+			WidgetTypeString.Contains(TEXT("SButton")) ||
+			WidgetTypeString.Contains(TEXT("SSpinBox")) ||
+			WidgetTypeString.Contains(TEXT("SEditableText"));
+	}
+
+	static double ToMicroseconds(const double Seconds, const int32 Count)
+	{
+		return Count > 0 ? Seconds * 1000000.0 / Count : 0.0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUINavFocusChurnBenchmark, "UINavigation.Benchmarks.FocusChurn", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FUINavFocusChurnBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace UINavTests;
+	using namespace UINavWidgetBenchmarks;
+
+	UUINavPCComponent* const UINavPC = GetUINavPC(*this);
+	if (UINavPC == nullptr)
+	{
+		return false;
+	}
+
+	const int32 NumButtons = 500;
+	const int32 NumSweeps = 10;
+	const int32 NumFocusChanges = NumButtons * NumSweeps;
+
+	TArray<UUINavComponent*> Components;
+	UUINavWidget* const Widget = CreateTestWidget(UINavPC->GetPC(), NumButtons, Components);
+	UINavPC->GoToBuiltWidget(Widget, false);
+
+	// Moves focus across every button and back, like the mouse sweeping over them
+	const double SweepStartTime = FPlatformTime::Seconds();
+	for (int32 Sweep = 0; Sweep < NumSweeps; ++Sweep)
+	{
+		for (int32 i = 0; i < NumButtons; ++i)
+		{
+			Components[Sweep % 2 == 0 ? i : NumButtons - 1 - i]->NavButton->SetFocus();
+		}
+	}
+	const double SweepTime = FPlatformTime::Seconds() - SweepStartTime;
+
+	AddInfo(FString::Printf(TEXT("Focus churn: %d focus changes across %d buttons took %.2f ms, %.2f us per change"),
+		NumFocusChanges, NumButtons, SweepTime * 1000.0, ToMicroseconds(SweepTime, NumFocusChanges)));
+
+	// Each focus change classifies the type of the focused widget, so compare that on the types in a button's focus path
+	TArray<FName> FocusPathTypes;
+	for (TSharedPtr<SWidget> SlateWidget = Components[0]->NavButton->GetCachedWidget(); SlateWidget.IsValid(); SlateWidget = SlateWidget->GetParentWidget())
+	{
+		FocusPathTypes.Add(SlateWidget->GetType());
+	}
+	if (!TestTrue(TEXT("The buttons were built"), FocusPathTypes.Num() > 0))
+	{
+		Widget->RemoveFromParent();
+		return false;
+	}
+
+	for (const FName WidgetType : FocusPathTypes)
+	{
+		TestEqual(FString::Printf(TEXT("Classification of %s"), *WidgetType.ToString()),
+			UUINavComponent::IsFocusableWidgetType(WidgetType), IsFocusableWidgetTypeUncached(WidgetType));
+	}
+
+	const int32 NumClassifications = NumFocusChanges * FocusPathTypes.Num();
+	int32 NumFocusable = 0;
+
+	const double UncachedStartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumClassifications; ++i)
+	{
+		NumFocusable += IsFocusableWidgetTypeUncached(FocusPathTypes[i % FocusPathTypes.Num()]) ? 1 : 0;
+	}
+	const double UncachedTime = FPlatformTime::Seconds() - UncachedStartTime;
+
+	const double CachedStartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumClassifications; ++i)
+	{
+		NumFocusable -= UUINavComponent::IsFocusableWidgetType(FocusPathTypes[i % FocusPathTypes.Num()]) ? 1 : 0;
+	}
+	const double CachedTime = FPlatformTime::Seconds() - CachedStartTime;
+
+	TestEqual(TEXT("Focusable types found with and without cached type names"), NumFocusable, 0);
+	AddInfo(FString::Printf(TEXT("Focused type checks: %.3f us with substring matching, %.3f us with cached type names (%.1fx)"),
+		ToMicroseconds(UncachedTime, NumClassifications), ToMicroseconds(CachedTime, NumClassifications), CachedTime > 0.0 ? UncachedTime / CachedTime : 0.0));
+
+	Widget->RemoveFromParent();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUINavBatchRefillBenchmark, "UINavigation.Benchmarks.BatchRefill", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FUINavBatchRefillBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace UINavTests;
+	using namespace UINavWidgetBenchmarks;
+
+	UUINavPCComponent* const UINavPC = GetUINavPC(*this);
+	if (UINavPC == nullptr)
+	{
+		return false;
+	}
+
+	const int32 NumSlots = 1000;
+	const int32 NumRefills = 5;
+
+	TArray<UUINavComponent*> Components;
+	UUINavWidget* const Widget = CreateTestWidget(UINavPC->GetPC(), NumSlots, Components);
+	UPanelWidget* const Panel = CastChecked<UPanelWidget>(Widget->WidgetTree->RootWidget);
+	UINavPC->GoToBuiltWidget(Widget, false);
+
+	// Replaces every slot with a new component, like an inventory grid showing another page
+	const auto Refill = [Widget, Panel, &Components, NumSlots](const bool bBatched)
+	{
+		Components.Reset();
+		for (int32 i = 0; i < NumSlots; ++i)
+		{
+			Components.Add(CreateComponent(Widget));
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		if (bBatched)
+		{
+			Widget->BeginComponentBatch();
+			Panel->ClearChildren();
+			Widget->AddComponents(Panel, Components);
+			Widget->EndComponentBatch();
+		}
+		else
+		{
+			Panel->ClearChildren();
+			for (UUINavComponent* const Component : Components)
+			{
+				Panel->AddChild(Component);
+			}
+		}
+		return FPlatformTime::Seconds() - StartTime;
+	};
+
+	double UnbatchedTime = 0.0;
+	double BatchedTime = 0.0;
+	for (int32 i = 0; i < NumRefills; ++i)
+	{
+		UnbatchedTime += Refill(false);
+		BatchedTime += Refill(true);
+
+		TestEqual(TEXT("Slots after a batched refill"), Panel->GetChildrenCount(), NumSlots);
+		TestTrue(TEXT("A batched refill assigns a new first component"), Components.Contains(Widget->GetFirstComponent()));
+	}
+
+	AddInfo(FString::Printf(TEXT("Refilling %d slots: %.2f ms one component at a time, %.2f ms in a component batch (%.1fx)"),
+		NumSlots, UnbatchedTime * 1000.0 / NumRefills, BatchedTime * 1000.0 / NumRefills, BatchedTime > 0.0 ? UnbatchedTime / BatchedTime : 0.0));
+
+	Widget->RemoveFromParent();
+	return true;
+}
+
+#endif
@@ -73,6 +73,13 @@ void UUINavBlueprintFunctionLibrary::ResetInputSettings(APlayerController* PC)
 {
 	if (IsValid(PC))
 	{
+		UUINavPCComponent* UINavPC = PC->FindComponentByClass<UUINavPCComponent>();
+		if (IsValid(UINavPC))
+		{
+			UINavPC->ResetAllBindingsToDefault();
+			return;
+		}
+
 		UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PC->GetLocalPlayer());
 		if (PC->InputComponent->IsA<UEnhancedInputComponent>() && Subsystem != nullptr)
 		{
@@ -89,6 +96,12 @@ void UUINavBlueprintFunctionLibrary::ResetInputSettings(APlayerController* PC)
 				const FInputMappingArray& DefaultMappings = Entry.Value;
 				if (DefaultMappings.DefaultInputMappings.Num() == 0) continue;
 
+				if (const FMappingContextSnapshot* const DefaultMappingsSnapshot = DefaultUINavInputSettings->GetDefaultMappings(InputContext))
+				{
+					DefaultMappingsSnapshot->Restore(InputContext);
+					continue;
+				}
+
 				InputContext->UnmapAll();
 
 				for (const FUINavEnhancedActionKeyMapping& DefaultInputMapping : DefaultMappings.DefaultInputMappings)
@@ -111,12 +124,6 @@ void UUINavBlueprintFunctionLibrary::ResetInputSettings(APlayerController* PC)
 				}
 			}
 
-			UUINavPCComponent* UINavPC = PC->FindComponentByClass<UUINavPCComponent>();
-			if (IsValid(UINavPC))
-			{
-				UINavPC->RefreshNavigationKeys();
-			}
-
 			Subsystem->RequestRebuildControlMappings();
 		}
 	}
@@ -124,39 +131,102 @@ void UUINavBlueprintFunctionLibrary::ResetInputSettings(APlayerController* PC)
 
 bool UUINavBlueprintFunctionLibrary::RespectsRestriction(const FKey Key, const EInputRestriction Restriction)
 {
-#if IS_VR_PLATFORM
-	const FString HMD = GEngine->XRSystem != nullptr ? GEngine->XRSystem->GetSystemName().ToString() : TEXT("");
-#else
-	const FString HMD = TEXT("");
-#endif
-	
-	switch (Restriction)
+	if (Restriction == EInputRestriction::None)
 	{
-	case EInputRestriction::None:
 		return true;
+	}
+
+	const EKeyClassification Classification = GetKeyClassification(Key);
+	switch (Restriction)
+	{
 	case EInputRestriction::Keyboard:
-		return (!Key.IsMouseButton() && !Key.IsGamepadKey());
+		return EnumHasAnyFlags(Classification, EKeyClassification::Keyboard);
 	case EInputRestriction::Mouse:
-		return Key.IsMouseButton();
+		return EnumHasAnyFlags(Classification, EKeyClassification::Mouse);
 	case EInputRestriction::Keyboard_Mouse:
-		return !Key.IsGamepadKey();
+		return !EnumHasAnyFlags(Classification, EKeyClassification::Gamepad);
 	case EInputRestriction::VR:
-		if (HMD == "") return false;
-		
-		if (HMD == "OculusHMD") {
-			return IsKeyInCategory(Key, "Oculus");
-		}
-		if (HMD == "Morpheus") {
-			return IsKeyInCategory(Key, "PSMove");
-		}
-		return false;
+		return EnumHasAnyFlags(Classification, GetHMDKeyClassification());
 	case EInputRestriction::Gamepad:
-		return (Key.IsGamepadKey() && !IsVRKey(Key));
+		return EnumHasAnyFlags(Classification, EKeyClassification::Gamepad) && !EnumHasAnyFlags(Classification, EKeyClassification::VR);
 	}
 
 	return false;
 }
 
+static EKeyClassification ClassifyKey(const FKey& Key)
+{
+	EKeyClassification Classification = EKeyClassification::None;
+
+	if (Key.IsGamepadKey())
+	{
+		Classification |= EKeyClassification::Gamepad;
+	}
+	if (Key.IsMouseButton())
+	{
+		Classification |= EKeyClassification::Mouse;
+	}
+	if (!Key.IsGamepadKey() && !Key.IsMouseButton())
+	{
+		Classification |= EKeyClassification::Keyboard;
+	}
+	if (Key.IsAxis1D() || Key.IsAxis2D() || Key.IsAxis3D())
+	{
+		Classification |= EKeyClassification::Axis;
+	}
+
+	const FString KeyName = Key.ToString();
+	if (KeyName.Contains(TEXT("Oculus"))) Classification |= EKeyClassification::Oculus;
+	if (KeyName.Contains(TEXT("Vive"))) Classification |= EKeyClassification::Vive;
+	if (KeyName.Contains(TEXT("MixedReality"))) Classification |= EKeyClassification::MixedReality;
+	if (KeyName.Contains(TEXT("Valve"))) Classification |= EKeyClassification::Valve;
+	if (KeyName.Contains(TEXT("PSMove"))) Classification |= EKeyClassification::PSMove;
+
+	return Classification;
+}
+
+EKeyClassification UUINavBlueprintFunctionLibrary::GetKeyClassification(const FKey& Key)
+{
+	// Only accessed from the game thread
+	static TMap<FKey, EKeyClassification> KeyClassifications;
+
+	if (const EKeyClassification* const Classification = KeyClassifications.Find(Key))
+	{
+		return *Classification;
+	}
+
+	// Keys whose details aren't registered yet can't be classified correctly, so they're not cached
+	if (!Key.IsValid())
+	{
+		return ClassifyKey(Key);
+	}
+
+	return KeyClassifications.Add(Key, ClassifyKey(Key));
+}
+
+EKeyClassification UUINavBlueprintFunctionLibrary::GetHMDKeyClassification()
+{
+#if IS_VR_PLATFORM
+	static const FName OculusHMDName(TEXT("OculusHMD"));
+	static const FName MorpheusName(TEXT("Morpheus"));
+	static FName CachedSystemName = NAME_None;
+	static EKeyClassification CachedClassification = EKeyClassification::None;
+
+	const FName SystemName = GEngine->XRSystem != nullptr ? GEngine->XRSystem->GetSystemName() : NAME_None;
+	if (SystemName != CachedSystemName)
+	{
+		CachedSystemName = SystemName;
+		CachedClassification = SystemName == OculusHMDName ? EKeyClassification::Oculus :
+			SystemName == MorpheusName ? EKeyClassification::PSMove :
+			EKeyClassification::None;
+	}
+
+	return CachedClassification;
+#else
+	return EKeyClassification::None;
+#endif
+}
+
 bool UUINavBlueprintFunctionLibrary::IsGamepadConnected()
 {
 	return FSlateApplication::Get().IsGamepadAttached();
@@ -359,11 +429,27 @@ const UUINavSettings* UUINavBlueprintFunctionLibrary::GetUINavSettings()
 
 bool UUINavBlueprintFunctionLibrary::IsVRKey(const FKey Key)
 {
-	return IsKeyInCategory(Key, "Oculus") || IsKeyInCategory(Key, "Vive") ||
-		IsKeyInCategory(Key, "MixedReality") || IsKeyInCategory(Key, "Valve") || IsKeyInCategory(Key, "PSMove");
+	return EnumHasAnyFlags(GetKeyClassification(Key), EKeyClassification::VR);
 }
 
 bool UUINavBlueprintFunctionLibrary::IsKeyInCategory(const FKey Key, const FString Category)
 {
+	// The categories known by the classification table don't need a string search
+	static const TPair<const TCHAR*, EKeyClassification> KnownCategories[] = {
+		{ TEXT("Oculus"), EKeyClassification::Oculus },
+		{ TEXT("Vive"), EKeyClassification::Vive },
+		{ TEXT("MixedReality"), EKeyClassification::MixedReality },
+		{ TEXT("Valve"), EKeyClassification::Valve },
+		{ TEXT("PSMove"), EKeyClassification::PSMove },
+	};
+
+	for (const TPair<const TCHAR*, EKeyClassification>& KnownCategory : KnownCategories)
+	{
+		if (Category.Equals(KnownCategory.Key, ESearchCase::IgnoreCase))
+		{
+			return EnumHasAnyFlags(GetKeyClassification(Key), KnownCategory.Value);
+		}
+	}
+
 	return Key.ToString().Contains(Category);
 }
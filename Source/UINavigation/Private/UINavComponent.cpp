@@ -31,29 +31,60 @@ void UUINavComponent::NativeConstruct()
 	NavButton->OnHovered.AddUniqueDynamic(this, &UUINavComponent::OnButtonHovered);
 	NavButton->OnUnhovered.AddUniqueDynamic(this, &UUINavComponent::OnButtonUnhovered);
 
+	NavButton->RemoveAllFieldValueChangedDelegates(this);
+	NavButton->AddFieldValueChangedDelegate(UWidget::FFieldNotificationClassDescriptor::Visibility,
+		INotifyFieldValueChanged::FFieldValueChangedDelegate::CreateUObject(this, &UUINavComponent::OnNavButtonFieldChanged));
+	NavButton->AddFieldValueChangedDelegate(UWidget::FFieldNotificationClassDescriptor::bIsEnabled,
+		INotifyFieldValueChanged::FFieldValueChangedDelegate::CreateUObject(this, &UUINavComponent::OnNavButtonFieldChanged));
+	RefreshNavigable();
+
 	Super::NativeConstruct();
 
-	if (!IsValid(ParentWidget))
+	const bool bFirstConstruct = !IsValid(ParentWidget);
+	if (bFirstConstruct)
 	{
 		ParentWidget = UUINavWidget::GetOuterObject<UUINavWidget>(this);
 
 		if (!IsValid(ParentWidget))
 		{
 			DISPLAYERROR("UI Nav Component isn't in a UINavWidget!");
+			return;
 		}
-		else if (!IsValid(ParentWidget->GetFirstComponent()) && CanBeNavigated())
+	}
+
+	if (UUINavWidget* const BatchOwner = ParentWidget->GetComponentBatchOwner())
+	{
+		BatchOwner->DeferComponentConstruct(this);
+		return;
+	}
+
+	if (ParentWidget->DeferComponentSetup(this))
+	{
+		return;
+	}
+
+	if (bFirstConstruct && !IsValid(ParentWidget->GetFirstComponent()) && CanBeNavigated())
+	{
+		ParentWidget->SetFirstComponent(this);
+		if (ParentWidget->bCompletedSetup)
 		{
-			ParentWidget->SetFirstComponent(this);
-			if (ParentWidget->bCompletedSetup)
-			{
-				SetFocus();
-			}
+			SetFocus();
 		}
 	}
+
+	if (!IsValid(RegistryOwner))
+	{
+		ParentWidget->RegisterComponent(this);
+	}
 }
 
 void UUINavComponent::NativeDestruct()
 {
+	if (IsValid(RegistryOwner))
+	{
+		RegistryOwner->GetComponentRegistry().Remove(this);
+	}
+
 	if (IsValid(ParentWidget) && !ParentWidget->IsBeingRemoved())
 	{
 		ParentWidget->RemovedComponent(this);
@@ -303,13 +334,39 @@ void UUINavComponent::ExecuteComponentActions(const EComponentAction Action)
 	}
 }
 
-bool UUINavComponent::CanBeNavigated() const
+void UUINavComponent::RefreshNavigable()
 {
-	const bool bIgnoreDisabled = GetDefault<UUINavSettings>()->bIgnoreDisabledButton;
-	return ((GetVisibility() == ESlateVisibility::Visible || GetVisibility() == ESlateVisibility::SelfHitTestInvisible) &&
-		(GetIsEnabled() || !bIgnoreDisabled) &&
+	const bool bIgnoreDisabledButton = GetDefault<UUINavSettings>()->bIgnoreDisabledButton;
+	const ESlateVisibility CurrentVisibility = GetVisibility();
+	bCanBeNavigated = (CurrentVisibility == ESlateVisibility::Visible || CurrentVisibility == ESlateVisibility::SelfHitTestInvisible) &&
+		(GetIsEnabled() || !bIgnoreDisabledButton) &&
+		IsValid(NavButton) &&
 		NavButton->GetVisibility() == ESlateVisibility::Visible &&
-		(NavButton->GetIsEnabled() || !bIgnoreDisabled));
+		(NavButton->GetIsEnabled() || !bIgnoreDisabledButton);
+
+	if (IsValid(RegistryOwner))
+	{
+		RegistryOwner->GetComponentRegistry().SetNavigable(RegistryIndex, bCanBeNavigated);
+	}
+}
+
+void UUINavComponent::OnNavButtonFieldChanged(UObject* Object, UE::FieldNotification::FFieldId FieldId)
+{
+	RefreshNavigable();
+}
+
+void UUINavComponent::SetVisibility(ESlateVisibility InVisibility)
+{
+	Super::SetVisibility(InVisibility);
+
+	RefreshNavigable();
+}
+
+void UUINavComponent::SetIsEnabled(bool bInIsEnabled)
+{
+	Super::SetIsEnabled(bInIsEnabled);
+
+	RefreshNavigable();
 }
 
 FReply UUINavComponent::NativeOnFocusReceived(const FGeometry& InGeometry, const FFocusEvent& InFocusEvent)
@@ -329,14 +386,28 @@ void UUINavComponent::NativeOnFocusLost(const FFocusEvent& InFocusEvent)
 	HandleFocusLost();
 }
 
+bool UUINavComponent::IsFocusableWidgetType(const FName WidgetType)
+{
+	// Type names are only matched once each, since this runs on every focus change
+	static TMap<FName, bool> FocusableTypes;
+	if (const bool* const bFoundFocusable = FocusableTypes.Find(WidgetType))
+	{
+		return *bFoundFocusable;
+	}
+
+	const FString WidgetTypeString = WidgetType.ToString();
+	const bool bFocusable = WidgetTypeString.Contains(TEXT("SObjectWidget")) ||
+		WidgetTypeString.Contains(TEXT("SButton")) ||
+		WidgetTypeString.Contains(TEXT("SSpinBox")) ||
+		WidgetTypeString.Contains(TEXT("SEditableText"));
+	FocusableTypes.Add(WidgetType, bFocusable);
+	return bFocusable;
+}
+
 void UUINavComponent::NativeOnFocusChanging(const FWeakWidgetPath& PreviousFocusPath, const FWidgetPath& NewWidgetPath, const FFocusEvent& InFocusEvent)
 {
 	Super::NativeOnFocusChanging(PreviousFocusPath, NewWidgetPath, InFocusEvent);
 
-	const bool bHadFocus = PreviousFocusPath.ContainsWidget(&TakeWidget().Get());
-	const bool bHasFocus = NewWidgetPath.ContainsWidget(&TakeWidget().Get());
-	const bool bHasButtonFocus = NewWidgetPath.ContainsWidget(&NavButton->TakeWidget().Get());
-
 	if (NewWidgetPath.Widgets.Num() == 0)
 	{
 		return;
@@ -348,7 +419,8 @@ void UUINavComponent::NativeOnFocusChanging(const FWeakWidgetPath& PreviousFocus
 		TSharedPtr<SWidget> PreviousWidget = PreviousFocusPath.Widgets[WidgetIndex].Pin();
 		if (PreviousWidget.IsValid())
 		{
-			while (!PreviousWidget->GetType().IsEqual(FName(TEXT("SObjectWidget"))) && --WidgetIndex > 0)
+			static const FName ObjectWidgetType(TEXT("SObjectWidget"));
+			while (PreviousWidget->GetType() != ObjectWidgetType && --WidgetIndex > 0)
 			{
 				PreviousWidget = PreviousFocusPath.Widgets[WidgetIndex].Pin();
 				TSharedPtr<SObjectWidget> PreviousUserWidget = StaticCastSharedPtr<SObjectWidget>(PreviousWidget);
@@ -358,16 +430,16 @@ void UUINavComponent::NativeOnFocusChanging(const FWeakWidgetPath& PreviousFocus
 		}
 	}
 
-	const FString WidgetTypeString = NewWidgetPath.GetLastWidget()->GetType().ToString();
-	if (!WidgetTypeString.Contains(TEXT("SObjectWidget")) &&
-		!WidgetTypeString.Contains(TEXT("SButton")) &&
-		!WidgetTypeString.Contains(TEXT("SSpinBox")) &&
-		!WidgetTypeString.Contains(TEXT("SEditableText")))
+	if (!IsFocusableWidgetType(NewWidgetPath.GetLastWidget()->GetType()))
 	{
 		NavButton->SetFocus();
 		return;
 	}
 
+	const SWidget* const ComponentWidget = &TakeWidget().Get();
+	const bool bHadFocus = PreviousFocusPath.ContainsWidget(ComponentWidget);
+	const bool bHasFocus = NewWidgetPath.ContainsWidget(ComponentWidget);
+
 	if (!bHadFocus && bHasFocus)
 	{
 		HandleFocusReceived();
@@ -377,7 +449,7 @@ void UUINavComponent::NativeOnFocusChanging(const FWeakWidgetPath& PreviousFocus
 		HandleFocusLost();
 	}
 
-	if (bHasFocus && !bHasButtonFocus)
+	if (bHasFocus && !NewWidgetPath.ContainsWidget(&NavButton->TakeWidget().Get()))
 	{
 		NavButton->SetFocus();
 	}
@@ -10,6 +10,8 @@
 #include "Components/TextBlock.h"
 #include "Components/Image.h"
 #include "Data/RevertRebindReason.h"
+#include "Data/InputBoxData.h"
+#include "Data/SharedInputModifiers.h"
 #include "Engine/DataTable.h"
 #include "GameFramework/InputSettings.h"
 #include "Blueprint/WidgetBlueprintLibrary.h"
@@ -47,41 +49,129 @@ void UUINavInputBox::CreateKeyWidgets()
 	ProcessInputName();
 
 	CreateEnhancedInputKeyWidgets();
+	StoreKeysInData();
+}
+
+void UUINavInputBox::CreateKeyWidgetsFromData()
+{
+	if (!IsValid(InputBoxData))
+	{
+		return;
+	}
+
+	InputButtons = { InputButton1, InputButton2, InputButton3 };
+	ProcessInputName();
+
+	Keys = InputBoxData->Keys;
+	for (int j = 0; j < 3; j++)
+	{
+		UUINavInputComponent* const InputButton = InputButtons[j];
+		if (!Keys.IsValidIndex(j))
+		{
+			Keys.Add(FKey());
+		}
+
+		if (j >= KeysPerInput)
+		{
+			InputButton->SetVisibility(Container->bCollapseInputBoxes ? ESlateVisibility::Collapsed : ESlateVisibility::Hidden);
+		}
+
+		// This input box may have been displaying another action's keys, so reset every visual
+		bUsingKeyImage[j] = j < KeysPerInput && Keys[j].IsValid() && UpdateKeyIconForKey(j);
+		InputButton->InputImage->SetVisibility(bUsingKeyImage[j] ? ESlateVisibility::SelfHitTestInvisible : ESlateVisibility::Collapsed);
+		InputButton->NavText->SetVisibility(bUsingKeyImage[j] ? ESlateVisibility::Collapsed : ESlateVisibility::SelfHitTestInvisible);
+		InputButton->SetText(j < KeysPerInput && Keys[j].IsValid() ? GetKeyText(j) : Container->EmptyKeyText);
+	}
+}
+
+void UUINavInputBox::SetInputBoxData(UInputBoxData* NewInputBoxData)
+{
+	if (AwaitingIndex >= 0 && IsValid(Container))
+	{
+		Container->UINavPC->CancelRebind();
+	}
+
+	InputBoxData = NewInputBoxData;
+	Container = InputBoxData->Container;
+	KeysPerInput = Container->KeysPerInput;
+	InputContext = InputBoxData->InputContext;
+	InputActionData = InputBoxData->InputActionData;
+	EnhancedInputGroups = InputBoxData->EnhancedInputGroups;
+	AxisType = EAxisType::None;
+	AwaitingIndex = -1;
+	Keys.Reset();
+	bUsingKeyImage = { false, false, false };
+}
+
+void UUINavInputBox::StoreKeysInData()
+{
+	if (IsValid(InputBoxData))
+	{
+		Container->StoreInputBoxDataKeys(InputBoxData, Keys);
+	}
+}
+
+void UUINavInputBox::NativeOnListItemObjectSet(UObject* ListItemObject)
+{
+	UInputBoxData* NewInputBoxData = Cast<UInputBoxData>(ListItemObject);
+	if (!IsValid(NewInputBoxData))
+	{
+		return;
+	}
+
+	SetInputBoxData(NewInputBoxData);
+
+	// The action's keys are only computed the first time it's displayed
+	if (!NewInputBoxData->bKeysComputed)
+	{
+		CreateKeyWidgets();
+	}
+
+	// This entry may have been displaying another action, so its visuals are always reset from the data
+	CreateKeyWidgetsFromData();
 }
 
 void UUINavInputBox::CreateEnhancedInputKeyWidgets()
 {
+	InputContext = Container->UINavPC->GetPlayerInputContext(InputContext);
+
 	const TArray<FEnhancedActionKeyMapping>& ActionMappings = InputContext->GetMappings();
+	const TArrayView<const FIndexedActionMapping> IndexedMappings = Container->UINavPC->GetIndexedActionMappings(InputContext, InputActionData.Action);
 	for (int j = 0; j < 3; j++)
 	{
 		UUINavInputComponent* NewInputButton = InputButtons[j];
 		if (j < KeysPerInput)
 		{
-			for (int i = ActionMappings.Num() - 1; i >= 0; --i)
+			// These only depend on the key index, so they're found once instead of once per mapping
+			const FKey OppositeKey = Container->GetOppositeInputKey(InputActionData, j);
+			int NumMappingsForAction = 0;
+			for (const FIndexedActionMapping& IndexedMapping : IndexedMappings)
 			{
-				const FEnhancedActionKeyMapping& ActionMapping = ActionMappings[i];
-				if (ActionMapping.Action != InputActionData.Action)
+				if (IndexedMapping.GetAxis(InputActionData.Axis) == InputActionData.Axis &&
+					Container->RespectsRestriction(ActionMappings[IndexedMapping.MappingIndex].Key, j))
 				{
-					continue;
+					++NumMappingsForAction;
 				}
+			}
 
-				bool bPositive;
-				EInputAxis Axis = InputActionData.Axis;
-				Container->GetAxisPropertiesFromMapping(ActionMapping, bPositive, Axis);
-				TArray<int32> MappingsForAction;
-				GetEnhancedMappingsForAction(ActionMapping.Action, InputActionData.Axis, j, MappingsForAction);
-				UUINavInputBox* OppositeInputBox = Container->GetOppositeInputBox(InputActionData);
+			for (int i = IndexedMappings.Num() - 1; i >= 0; --i)
+			{
+				const FIndexedActionMapping& IndexedMapping = IndexedMappings[i];
+				const FEnhancedActionKeyMapping& ActionMapping = ActionMappings[IndexedMapping.MappingIndex];
+
+				const EInputAxis Axis = IndexedMapping.GetAxis(InputActionData.Axis);
+				const bool bPositive = IndexedMapping.IsPositive(Axis);
 				FKey NewKey = ActionMapping.Key;
 
 				if ((InputActionData.Axis == Axis || Container->UINavPC->IsAxis2D(NewKey)) &&
-					(OppositeInputBox == nullptr || !OppositeInputBox->Keys.IsValidIndex(j) || OppositeInputBox->Keys[j] != ActionMapping.Key) &&
-					(MappingsForAction.Num() < 2 || GetNumValidKeys(j) < (MappingsForAction.Num() / 2)))
+					(!OppositeKey.IsValid() || OppositeKey != ActionMapping.Key) &&
+					(NumMappingsForAction < 2 || GetNumValidKeys(j) < (NumMappingsForAction / 2)))
 				{
 					if (Container->UINavPC->IsAxis(NewKey) && InputActionData.AxisScale != EAxisType::None)
 					{
 						NewKey = Container->UINavPC->GetKeyFromAxis(NewKey, bPositive ? IS_POSITIVE_AXIS : !IS_POSITIVE_AXIS, InputActionData.Axis);
 					}
-					else if (OppositeInputBox != nullptr &&
+					else if (Container->HasOppositeInputAction(InputActionData) &&
 						InputActionData.AxisScale != EAxisType::None &&
 						(InputActionData.AxisScale == EAxisType::Positive) != bPositive)
 					{
@@ -175,11 +265,11 @@ void UUINavInputBox::UpdateInputKey(const FKey NewKey, int Index, const bool bSk
 				return;
 			}
 
-			int SelfIndex = INDEX_NONE;
+			const int SelfIndex = Container->GetInputBoxIndex(this);
 
 			FInputRebindData CollidingInputData;
 			Container->GetEnhancedInputRebindData(CollidingActionIndex, CollidingInputData);
-			if (!Container->InputBoxes.Find(this, SelfIndex) ||
+			if (SelfIndex == INDEX_NONE ||
 				!Container->RequestKeySwap(FInputCollisionData(InputText->GetText(),
 					CollidingInputData.InputText,
 					CollidingKeyIndex,
@@ -210,13 +300,16 @@ void UUINavInputBox::FinishUpdateNewKey()
 	FinishUpdateNewEnhancedInputKey(AwaitingNewKey, AwaitingIndex);
 
 	Container->OnKeyRebinded(InputName, OldKey, Keys[AwaitingIndex]);
+	Container->UINavPC->RecordTelemetry(ENavigationTelemetryEvent::KeyRebound, InputName, AwaitingIndex);
 	Container->UINavPC->RefreshNavigationKeys();
 	AwaitingIndex = -1;
 }
 
 void UUINavInputBox::FinishUpdateNewEnhancedInputKey(const FKey PressedKey, const int Index)
 {
-	const TArray<FEnhancedActionKeyMapping>& ActionMappings = InputContext->GetMappings();
+	// Rebinding only modifies this player's copy of the context
+	InputContext = Container->UINavPC->GetMutableInputContext(InputContext);
+	Container->UINavPC->NotifyMappingContextModified(InputContext);
 
 	bool bPositive;
 	const FKey PressedAxisKey = Container->UINavPC->GetAxisFromScaledKey(PressedKey, bPositive);
@@ -226,74 +319,64 @@ void UUINavInputBox::FinishUpdateNewEnhancedInputKey(const FKey PressedKey, cons
 	FKey OldAxisKey;
 	bool bFound = false;
 	bool bRemoved2DAxis = false;
-	const int Iterations = ActionMappings.Num();
-	int i = Iterations - 1;
-	for (; i >= 0; --i)
+	const TArrayView<const FIndexedActionMapping> IndexedMappings = Container->UINavPC->GetIndexedActionMappings(InputContext, InputActionData.Action);
+	for (int i = IndexedMappings.Num() - 1; i >= 0; --i)
 	{
-		FEnhancedActionKeyMapping& ActionMapping = InputContext->GetMapping(i);
-		if (ActionMapping.Action == InputActionData.Action)
+		const FIndexedActionMapping& IndexedMapping = IndexedMappings[i];
+		const FEnhancedActionKeyMapping& ActionMapping = InputContext->GetMapping(IndexedMapping.MappingIndex);
+		if (InputActionData.Axis == IndexedMapping.GetAxis(InputActionData.Axis))
 		{
-			EInputAxis Axis = InputActionData.Axis;
-			Container->GetAxisPropertiesFromMapping(ActionMapping, bPositive, Axis);
-			if (InputActionData.Axis == Axis)
+			const FKey& MappingKey = GetKeyFromAxis(ActionMapping.Key);
+			if (Container->RespectsRestriction(NewKey, Index) &&
+				Container->RespectsRestriction(MappingKey, Index))
 			{
-				const FKey& MappingKey = GetKeyFromAxis(ActionMapping.Key);
-				if (Container->RespectsRestriction(NewKey, Index) &&
-					Container->RespectsRestriction(MappingKey, Index))
+				if (MappingKey == Keys[Index])
 				{
-					if (MappingKey == Keys[Index])
+					if (IS_AXIS &&
+						Container->UINavPC->IsAxis(ActionMapping.Key) &&
+						InputActionData.AxisScale != EAxisType::None)
 					{
-						if (IS_AXIS)
+						bool bNewKeyPositive = true;
+						if (Container->UINavPC->GetAxisFromScaledKey(NewKey, bNewKeyPositive).IsValid())
 						{
-							if (Container->UINavPC->IsAxis(ActionMapping.Key) &&
-								InputActionData.AxisScale != EAxisType::None)
-							{
-								bool bNewKeyPositive = true;
-								if (Container->UINavPC->GetAxisFromScaledKey(NewKey, bNewKeyPositive).IsValid())
-								{
-									NewAxisKey = NewKey;
-								}
-								else
-								{
-									OldAxisKey = ActionMapping.Key;
-								}
-								break;
-							}
-
-							ActionMapping.Key = NewKey;
+							NewAxisKey = NewKey;
 						}
 						else
 						{
-							ActionMapping.Key = NewKey;
+							OldAxisKey = ActionMapping.Key;
 						}
-						Keys[Index] = NewKey;
-						InputButtons[Index]->SetText(GetKeyText(Index));
-						bFound = true;
 						break;
 					}
-					else if (!Container->UINavPC->IsAxis(ActionMapping.Key) &&
-						Container->GetOppositeInputBox(InputActionData) != nullptr)
-					{
-						bool bOtherKeyPositive = true;
-						const FKey OtherKeyAxis = Container->UINavPC->GetAxisFromScaledKey(ActionMapping.Key, bOtherKeyPositive);
-						bool bNewKeyPositive = true;
-						const FKey NewKeyAxis = Container->UINavPC->GetAxisFromScaledKey(NewKey, bNewKeyPositive);
 
-						if (OtherKeyAxis == NewKeyAxis &&
-							bOtherKeyPositive != bNewKeyPositive &&
-							InputActionData.AxisScale != EAxisType::None &&
-							(InputActionData.AxisScale == EAxisType::Positive) == bNewKeyPositive)
-						{
-							NewAxisKey = NewKeyAxis;
-							break;
-						}
-					}
-					else
+					// Keeps the context's action index valid for the axis key checks below
+					Container->UINavPC->SetMappingKey(InputContext, IndexedMapping.MappingIndex, NewKey);
+					Keys[Index] = NewKey;
+					InputButtons[Index]->SetText(GetKeyText(Index));
+					bFound = true;
+					break;
+				}
+				else if (!Container->UINavPC->IsAxis(ActionMapping.Key) &&
+					Container->HasOppositeInputAction(InputActionData))
+				{
+					bool bOtherKeyPositive = true;
+					const FKey OtherKeyAxis = Container->UINavPC->GetAxisFromScaledKey(ActionMapping.Key, bOtherKeyPositive);
+					bool bNewKeyPositive = true;
+					const FKey NewKeyAxis = Container->UINavPC->GetAxisFromScaledKey(NewKey, bNewKeyPositive);
+
+					if (OtherKeyAxis == NewKeyAxis &&
+						bOtherKeyPositive != bNewKeyPositive &&
+						InputActionData.AxisScale != EAxisType::None &&
+						(InputActionData.AxisScale == EAxisType::Positive) == bNewKeyPositive)
 					{
-						OldAxisKey = ActionMapping.Key;
+						NewAxisKey = NewKeyAxis;
 						break;
 					}
 				}
+				else
+				{
+					OldAxisKey = ActionMapping.Key;
+					break;
+				}
 			}
 		}
 	}
@@ -314,18 +397,18 @@ void UUINavInputBox::FinishUpdateNewEnhancedInputKey(const FKey PressedKey, cons
 
 		// Add new key
 		const FKey Key = NewAxisKey.IsValid() ? NewAxisKey : NewKey;
-		FEnhancedActionKeyMapping& NewMapping = InputContext->MapKey(InputActionData.Action, Key);
+		FEnhancedActionKeyMapping& NewMapping = Container->UINavPC->MapContextKey(InputContext, InputActionData.Action, Key);
 		if (OldAxisKey.IsValid())
 		{
 			AddRelevantModifiers(InputActionData, NewMapping);
 			if (bRemoved2DAxis)
 			{
-				ApplyNegateModifiers(this, NewMapping, bNegateX, bNegateY, bNegateZ);
+				ApplyNegateModifiers(InputActionData, NewMapping, bNegateX, bNegateY, bNegateZ);
 			}
 		}
 		if (NewAxisKey.IsValid())
 		{
-			InputContext->UnmapKey(InputActionData.Action, Keys[Index]);
+			Container->UINavPC->UnmapContextKey(InputContext, InputActionData.Action, Keys[Index]);
 		}
 
 		// Remove old key
@@ -348,6 +431,7 @@ void UUINavInputBox::FinishUpdateNewEnhancedInputKey(const FKey PressedKey, cons
 	Container->UINavPC->RequestRebuildMappings();
 
 	UpdateKeyDisplay(Index);
+	StoreKeysInData();
 
 	if (bRemoved2DAxis)
 	{
@@ -357,10 +441,9 @@ void UUINavInputBox::FinishUpdateNewEnhancedInputKey(const FKey PressedKey, cons
 
 void UUINavInputBox::TryMapEnhancedAxisKey(const FKey& NewKey, const int32 Index)
 {
-	UUINavInputBox* OppositeInputBox = Container->GetOppositeInputBox(InputActionData);
-	if (OppositeInputBox != nullptr)
+	if (Container->HasOppositeInputAction(InputActionData))
 	{
-		const FKey OppositeInputBoxKey = OppositeInputBox->Keys.IsValidIndex(Index) ? OppositeInputBox->Keys[Index] : FKey();
+		const FKey OppositeInputBoxKey = Container->GetOppositeInputKey(InputActionData, Index);
 		bool bIsOppositeKeyPositive = false;
 		const FKey NewOppositeKey = Container->UINavPC->GetOppositeAxisKey(NewKey, bIsOppositeKeyPositive);
 		if (NewOppositeKey == OppositeInputBoxKey)
@@ -368,31 +451,22 @@ void UUINavInputBox::TryMapEnhancedAxisKey(const FKey& NewKey, const int32 Index
 			bool bNegateX = false;
 			bool bNegateY = false;
 			bool bNegateZ = false;
-
-			const TArray<FEnhancedActionKeyMapping>& ActionMappings = InputContext->GetMappings();
-			const FKey& CurrentKey = Keys[Index];
-			int32 MappingIndex = ActionMappings.IndexOfByPredicate([this, &CurrentKey](const FEnhancedActionKeyMapping& Other) { return Other.Action == InputActionData.Action && Other.Key == CurrentKey; });
-			if (MappingIndex != INDEX_NONE)
+			GetKeyMappingNegateAxes(Keys[Index], bNegateX, bNegateY, bNegateZ);
+			bNegateX = InputActionData.Axis == EInputAxis::X && bNegateX;
+			bNegateY = InputActionData.Axis == EInputAxis::Y && bNegateY;
+			bNegateZ = InputActionData.Axis == EInputAxis::Z && bNegateZ;
+
+			// The opposite input box may be showing half of an axis key, in which case there's no mapping to the opposite key to remove
+			const FIndexedActionMapping* const CurrentMapping = FindIndexedMapping(Keys[Index]);
+			if (CurrentMapping != nullptr && CurrentMapping->OppositeMappingIndex != INDEX_NONE)
 			{
-				const FEnhancedActionKeyMapping& OldMapping = InputContext->GetMapping(MappingIndex);
-				for (const UInputModifier* const Modifier : OldMapping.Modifiers)
-				{
-					const UInputModifierNegate* const NegateModifier = Cast<UInputModifierNegate>(Modifier);
-					if (IsValid(NegateModifier))
-					{
-						bNegateX = InputActionData.Axis == EInputAxis::X && NegateModifier->bX;
-						bNegateY = InputActionData.Axis == EInputAxis::Y && NegateModifier->bY;
-						bNegateZ = InputActionData.Axis == EInputAxis::Z && NegateModifier->bZ;
-					}
-				}
+				Container->UINavPC->UnmapContextKey(InputContext, InputActionData.Action, NewOppositeKey);
 			}
-
-			InputContext->UnmapKey(InputActionData.Action, NewOppositeKey);
-			InputContext->UnmapKey(InputActionData.Action, NewKey);
+			Container->UINavPC->UnmapContextKey(InputContext, InputActionData.Action, NewKey);
 			bool bPositive;
-			FEnhancedActionKeyMapping& NewMapping = InputContext->MapKey(InputActionData.Action, Container->UINavPC->GetAxisFromScaledKey(NewKey, bPositive));
+			FEnhancedActionKeyMapping& NewMapping = Container->UINavPC->MapContextKey(InputContext, InputActionData.Action, Container->UINavPC->GetAxisFromScaledKey(NewKey, bPositive));
 			AddRelevantModifiers(InputActionData, NewMapping);
-			ApplyNegateModifiers(this, NewMapping, bNegateX, bNegateY, bNegateZ);
+			ApplyNegateModifiers(InputActionData, NewMapping, bNegateX, bNegateY, bNegateZ);
 
 			TryMap2DAxisKey(NewMapping.Key, Index);
 		}
@@ -437,26 +511,26 @@ void UUINavInputBox::TryMap2DAxisKey(const FKey& NewMappingKey, const int Index)
 		bNegateY = InputActionData.Axis == EInputAxis::Y && bNegateY;
 		bNegateZ = InputActionData.Axis == EInputAxis::Z && bNegateZ;
 		
-		InputContext->UnmapKey(InputActionData.Action, NewMappingKey);
-		InputContext->UnmapKey(InputActionData.Action, OppositeAxis);
-		FEnhancedActionKeyMapping& NewMapping = InputContext->MapKey(InputActionData.Action, Container->UINavPC->GetAxis2DFromAxis1D(OppositeAxis));
-		ApplyNegateModifiers(this, NewMapping, bNegateX, bNegateY, bNegateZ);
+		Container->UINavPC->UnmapContextKey(InputContext, InputActionData.Action, NewMappingKey);
+		Container->UINavPC->UnmapContextKey(InputContext, InputActionData.Action, OppositeAxis);
+		FEnhancedActionKeyMapping& NewMapping = Container->UINavPC->MapContextKey(InputContext, InputActionData.Action, Container->UINavPC->GetAxis2DFromAxis1D(OppositeAxis));
+		ApplyNegateModifiers(InputActionData, NewMapping, bNegateX, bNegateY, bNegateZ);
 	}
 }
 
 void UUINavInputBox::UnmapEnhancedAxisKey(const FKey& NewAxisKey, const FKey& OldAxisKey, const FKey& NewKey, const int32 Index, const bool bNegateX, const bool bNegateY, const bool bNegateZ)
 {
-	UUINavInputBox* OppositeInputBox = Container->GetOppositeInputBox(InputActionData);
-	if (OppositeInputBox != nullptr)
+	const FInputContainerEnhancedActionData* const OppositeActionData = Container->GetOppositeInputActionData(InputActionData);
+	if (OppositeActionData != nullptr)
 	{
 		if (OldAxisKey.IsValid())
 		{
-			InputContext->UnmapKey(InputActionData.Action, OldAxisKey);
-			const FKey OppositeInputBoxKey = OppositeInputBox->Keys.IsValidIndex(Index) ? OppositeInputBox->Keys[Index] : FKey();
-			FEnhancedActionKeyMapping& NewMapping = InputContext->MapKey(InputActionData.Action, OppositeInputBoxKey);
-			AddRelevantModifiers(OppositeInputBox->InputActionData, NewMapping);
+			Container->UINavPC->UnmapContextKey(InputContext, InputActionData.Action, OldAxisKey);
+			const FKey OppositeInputBoxKey = Container->GetOppositeInputKey(InputActionData, Index);
+			FEnhancedActionKeyMapping& NewMapping = Container->UINavPC->MapContextKey(InputContext, InputActionData.Action, OppositeInputBoxKey);
+			AddRelevantModifiers(*OppositeActionData, NewMapping);
 
-			ApplyNegateModifiers(OppositeInputBox, NewMapping, bNegateX, bNegateY, bNegateZ);
+			ApplyNegateModifiers(*OppositeActionData, NewMapping, bNegateX, bNegateY, bNegateZ);
 
 			if (Container->UINavPC->IsAxis2D(OldAxisKey))
 			{
@@ -464,11 +538,10 @@ void UUINavInputBox::UnmapEnhancedAxisKey(const FKey& NewAxisKey, const FKey& Ol
 				const FKey NewAxis1D = Container->UINavPC->GetAxis1DFromAxis2D(OldAxisKey, OppositeAxis);
 				if (NewAxis1D.IsValid())
 				{
-					FEnhancedActionKeyMapping& NewAxis1DMapping = InputContext->MapKey(InputActionData.Action, NewAxis1D);
+					FEnhancedActionKeyMapping& NewAxis1DMapping = Container->UINavPC->MapContextKey(InputContext, InputActionData.Action, NewAxis1D);
 					if (OppositeAxis == EInputAxis::Y)
 					{
-						UInputModifierSwizzleAxis* SwizzleModifier = NewObject<UInputModifierSwizzleAxis>();
-						NewAxis1DMapping.Modifiers.Add(SwizzleModifier);
+						NewAxis1DMapping.Modifiers.Add(USharedInputModifiers::GetSwizzleModifier(EInputAxisSwizzle::YXZ));
 					}
 				}
 			}
@@ -476,7 +549,7 @@ void UUINavInputBox::UnmapEnhancedAxisKey(const FKey& NewAxisKey, const FKey& Ol
 		else if (NewAxisKey.IsValid())
 		{
 			bool bIsOppositeKeyPositive = false;
-			InputContext->UnmapKey(InputActionData.Action, Container->UINavPC->GetOppositeAxisKey(NewKey, bIsOppositeKeyPositive));
+			Container->UINavPC->UnmapContextKey(InputContext, InputActionData.Action, Container->UINavPC->GetOppositeAxisKey(NewKey, bIsOppositeKeyPositive));
 		}
 	}
 }
@@ -485,55 +558,50 @@ void UUINavInputBox::AddRelevantModifiers(const FInputContainerEnhancedActionDat
 {
 	if (ActionData.AxisScale == EAxisType::Negative)
 	{
-		UInputModifierNegate* NegateModifier = NewObject<UInputModifierNegate>();
-		NegateModifier->bX = ActionData.Axis == EInputAxis::X;
-		NegateModifier->bY = ActionData.Axis == EInputAxis::Y;
-		NegateModifier->bZ = ActionData.Axis == EInputAxis::Z;
-		Mapping.Modifiers.Add(NegateModifier);
+		Mapping.Modifiers.Add(USharedInputModifiers::GetNegateModifier(
+			ActionData.Axis == EInputAxis::X,
+			ActionData.Axis == EInputAxis::Y,
+			ActionData.Axis == EInputAxis::Z));
 	}
 
 	if (ActionData.Axis != EInputAxis::X)
 	{
-		UInputModifierSwizzleAxis* SwizzleModifier = NewObject<UInputModifierSwizzleAxis>();
-		if (ActionData.Axis == EInputAxis::Z)
-		{
-			SwizzleModifier->Order = EInputAxisSwizzle::ZXY;
-		}
-		Mapping.Modifiers.Add(SwizzleModifier);
+		Mapping.Modifiers.Add(USharedInputModifiers::GetSwizzleModifier(ActionData.Axis == EInputAxis::Z ? EInputAxisSwizzle::ZXY : EInputAxisSwizzle::YXZ));
 	}
 }
 
-void UUINavInputBox::ApplyNegateModifiers(UUINavInputBox* InputBox, FEnhancedActionKeyMapping& Mapping, const bool bNegateX, const bool bNegateY, const bool bNegateZ)
+void UUINavInputBox::ApplyNegateModifiers(const FInputContainerEnhancedActionData& ActionData, FEnhancedActionKeyMapping& Mapping, const bool bNegateX, const bool bNegateY, const bool bNegateZ)
 {
-	const bool bShouldNegateX = InputBox->InputActionData.Axis == EInputAxis::X && bNegateX && (InputBox->InputActionData.AxisScale == EAxisType::Positive) != bNegateX;
-	const bool bShouldNegateY = InputBox->InputActionData.Axis == EInputAxis::Y && bNegateY && (InputBox->InputActionData.AxisScale == EAxisType::Positive) != bNegateY;
-	const bool bShouldNegateZ = InputBox->InputActionData.Axis == EInputAxis::Z && bNegateZ && (InputBox->InputActionData.AxisScale == EAxisType::Positive) != bNegateZ;
+	const bool bShouldNegateX = ActionData.Axis == EInputAxis::X && bNegateX && (ActionData.AxisScale == EAxisType::Positive) != bNegateX;
+	const bool bShouldNegateY = ActionData.Axis == EInputAxis::Y && bNegateY && (ActionData.AxisScale == EAxisType::Positive) != bNegateY;
+	const bool bShouldNegateZ = ActionData.Axis == EInputAxis::Z && bNegateZ && (ActionData.AxisScale == EAxisType::Positive) != bNegateZ;
 
 	bool bHasNegateModifier = false;
 	for (int i = Mapping.Modifiers.Num() - 1; i >= 0; --i)
 	{
-		UInputModifierNegate* NegateModifier = Cast<UInputModifierNegate>(Mapping.Modifiers[i]);
+		// Negate modifiers may be shared, so they're replaced instead of modified
+		const UInputModifierNegate* const NegateModifier = Cast<UInputModifierNegate>(Mapping.Modifiers[i]);
 		if (IsValid(NegateModifier))
 		{
 			bHasNegateModifier = true;
-			NegateModifier->bX = NegateModifier->bX && bShouldNegateX;
-			NegateModifier->bY = NegateModifier->bY && bShouldNegateY;
-			NegateModifier->bZ = NegateModifier->bZ && bShouldNegateZ;
-			if (!NegateModifier->bX && !NegateModifier->bY && !NegateModifier->bZ)
+			const bool bX = NegateModifier->bX && bShouldNegateX;
+			const bool bY = NegateModifier->bY && bShouldNegateY;
+			const bool bZ = NegateModifier->bZ && bShouldNegateZ;
+			if (!bX && !bY && !bZ)
 			{
 				bHasNegateModifier = false;
 				Mapping.Modifiers.RemoveAt(i);
 			}
+			else
+			{
+				Mapping.Modifiers[i] = USharedInputModifiers::GetNegateModifier(bX, bY, bZ);
+			}
 		}
 	}
 
 	if (!bHasNegateModifier && (bShouldNegateX || bShouldNegateY || bShouldNegateZ))
 	{
-		UInputModifierNegate* NewNegateModifier = NewObject<UInputModifierNegate>();
-		NewNegateModifier->bX = bShouldNegateX;
-		NewNegateModifier->bY = bShouldNegateY;
-		NewNegateModifier->bZ = bShouldNegateZ;
-		Mapping.Modifiers.Add(NewNegateModifier);
+		Mapping.Modifiers.Add(USharedInputModifiers::GetNegateModifier(bShouldNegateX, bShouldNegateY, bShouldNegateZ));
 	}
 }
 
@@ -613,6 +681,12 @@ void UUINavInputBox::InputComponentClicked(const int Index)
 		return;
 	}
 
+	// Key collisions can only be checked once every input box exists
+	if (Container->IsCreatingInputBoxes())
+	{
+		return;
+	}
+
 	AwaitingIndex = Index;
 
 	InputButtons[Index]->SetText(Container->PressKeyText);
@@ -627,34 +701,40 @@ void UUINavInputBox::InputComponentClicked(const int Index)
 }
 
 void UUINavInputBox::GetEnhancedMappingsForAction(const UInputAction* Action, const EInputAxis& Axis, const int Index, TArray<int32>& OutMappingIndices)
+{
+	const TArrayView<const FIndexedActionMapping> IndexedMappings = Container->UINavPC->GetIndexedActionMappings(InputContext, Action);
+	for (int i = IndexedMappings.Num() - 1; i >= 0; --i)
+	{
+		const FIndexedActionMapping& IndexedMapping = IndexedMappings[i];
+		if (IndexedMapping.GetAxis(InputActionData.Axis) == Axis &&
+			Container->RespectsRestriction(InputContext->GetMapping(IndexedMapping.MappingIndex).Key, Index))
+		{
+			OutMappingIndices.Add(IndexedMapping.MappingIndex);
+		}
+	}
+}
+
+const FIndexedActionMapping* UUINavInputBox::FindIndexedMapping(const FKey& Key) const
 {
 	const TArray<FEnhancedActionKeyMapping>& ActionMappings = InputContext->GetMappings();
-	for (int i = ActionMappings.Num() - 1; i >= 0; --i)
+	for (const FIndexedActionMapping& IndexedMapping : Container->UINavPC->GetIndexedActionMappings(InputContext, InputActionData.Action))
 	{
-		const FEnhancedActionKeyMapping& ActionMapping = ActionMappings[i];
-		if (ActionMapping.Action == Action)
+		if (ActionMappings[IndexedMapping.MappingIndex].Key == Key)
 		{
-			bool bPositive;
-			EInputAxis ActionAxis = InputActionData.Axis;
-			Container->GetAxisPropertiesFromMapping(ActionMapping, bPositive, ActionAxis);
-			if (ActionAxis == Axis && Container->RespectsRestriction(ActionMapping.Key, Index))
-			{
-				OutMappingIndices.Add(i);
-			}
+			return &IndexedMapping;
 		}
 	}
+	return nullptr;
 }
 
 void UUINavInputBox::GetKeyMappingNegateAxes(const FKey& OldAxisKey, bool& bNegateX, bool& bNegateY, bool& bNegateZ)
 {
-	const TArray<FEnhancedActionKeyMapping>& ActionMappings = InputContext->GetMappings();
 	bNegateX = false;
 	bNegateY = false;
 	bNegateZ = false;
-	int32 MappingIndex = ActionMappings.IndexOfByPredicate([this, &OldAxisKey](const FEnhancedActionKeyMapping& Other) { return Other.Action == InputActionData.Action && Other.Key == OldAxisKey; });
-	if (MappingIndex != INDEX_NONE)
+	if (const FIndexedActionMapping* const IndexedMapping = FindIndexedMapping(OldAxisKey))
 	{
-		const FEnhancedActionKeyMapping& OldMapping = InputContext->GetMapping(MappingIndex);
+		const FEnhancedActionKeyMapping& OldMapping = InputContext->GetMapping(IndexedMapping->MappingIndex);
 		for (const UInputModifier* const Modifier : OldMapping.Modifiers)
 		{
 			const UInputModifierNegate* const NegateModifier = Cast<UInputModifierNegate>(Modifier);
@@ -13,6 +13,7 @@
 #include "Engine/DataTable.h"
 #include "GameFramework/PlayerController.h"
 #include "Components/PanelWidget.h"
+#include "Components/ListView.h"
 #include "Components/TextBlock.h"
 #include "IImageWrapper.h"
 #include "EnhancedInputComponent.h"
@@ -21,6 +22,23 @@
 #include "HAL/Platform.h"
 #include "Delegates/Delegate.h"
 #include "Data/PromptDataSwapKeys.h"
+#include "Data/InputBoxData.h"
+#include "Data/MappingContextActionIndex.h"
+#include "HAL/PlatformTime.h"
+
+static bool AreOppositeAxisTypes(const EAxisType AxisType, const EAxisType OtherAxisType)
+{
+	return (AxisType == EAxisType::Positive && OtherAxisType == EAxisType::Negative) ||
+		(AxisType == EAxisType::Negative && OtherAxisType == EAxisType::Positive);
+}
+
+// Whether both actions are the opposite directions of the same axis of the same input action
+static bool AreOppositeInputActions(const FInputContainerEnhancedActionData& ActionData, const FInputContainerEnhancedActionData& OtherActionData)
+{
+	return OtherActionData.Action == ActionData.Action &&
+		OtherActionData.Axis == ActionData.Axis &&
+		AreOppositeAxisTypes(OtherActionData.AxisScale, ActionData.AxisScale);
+}
 
 void UUINavInputContainer::NativeConstruct()
 {
@@ -33,13 +51,48 @@ void UUINavInputContainer::NativeConstruct()
 	else if (InputRestrictions.Num() > 3) InputRestrictions.SetNum(3);
 	KeysPerInput = InputRestrictions.Num();
 
+	CacheAllowedKeys();
+
 	DecidedCallback.BindUFunction(this, FName("SwapKeysDecided"));
 
-	SetupInputBoxes();
+	if (IsValid(UINavPC) && !UINavPC->AreInputContextsCached())
+	{
+		// The input boxes read the mapping contexts' default keys, so wait for them to be loaded
+		if (!UINavPC->InputContextsCachedDelegate.IsBoundToObject(this))
+		{
+			UINavPC->InputContextsCachedDelegate.AddUObject(this, &UUINavInputContainer::SetupInputBoxes);
+		}
+	}
+	else
+	{
+		SetupInputBoxes();
+	}
+
+	// A rolled back binding transaction leaves the input boxes showing the keys that were reverted
+	if (IsValid(UINavPC) && !UINavPC->OnBindingsReverted().IsBoundToObject(this))
+	{
+		UINavPC->OnBindingsReverted().AddUObject(this, &UUINavInputContainer::RefreshActionsKeys);
+	}
+
+	// Bindings can also be changed without going through the input boxes
+	if (IsValid(UINavPC) && !UINavPC->OnBindingsChanged().IsBoundToObject(this))
+	{
+		UINavPC->OnBindingsChanged().AddUObject(this, &UUINavInputContainer::RefreshActionsKeys);
+	}
 
 	Super::NativeConstruct();
 }
 
+void UUINavInputContainer::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	if (bCreatingInputBoxes)
+	{
+		CreateInputBoxesWithinBudget();
+	}
+}
+
 void UUINavInputContainer::OnAddInputBox_Implementation(class UUINavInputBox* NewInputBox)
 {
 	if (InputBoxesPanel != nullptr)
@@ -56,7 +109,7 @@ void UUINavInputContainer::OnRebindCancelled_Implementation(ERevertRebindReason
 {
 }
 
-bool UUINavInputContainer::RequestKeySwap(const FInputCollisionData& InputCollisionData, const int CurrentInputIndex, const int CollidingInputIndex) const
+bool UUINavInputContainer::RequestKeySwap(const FInputCollisionData& InputCollisionData, const int CurrentInputIndex, const int CollidingInputIndex)
 {
 	if (SwapKeysWidgetClass != nullptr)
 	{
@@ -68,8 +121,8 @@ bool UUINavInputContainer::RequestKeySwap(const FInputCollisionData& InputCollis
 		MessageArgs.Add(TEXT("CollidingAction"), InputCollisionData.CollidingInputText);
 		MessageArgs.Add(TEXT("OtherKey"), UINavPC->GetKeyText(InputCollisionData.CurrentInputKey));
 		SwapKeysWidget->Message = FText::Format(SwapKeysMessageText, MessageArgs);
-		SwapKeysWidget->CollidingInputBox = InputBoxes[CollidingInputIndex];
-		SwapKeysWidget->CurrentInputBox = InputBoxes[CurrentInputIndex];
+		SwapKeysWidget->CollidingInputBox = GetInputBoxForAction(CollidingInputIndex);
+		SwapKeysWidget->CurrentInputBox = GetInputBoxForAction(CurrentInputIndex);
 		SwapKeysWidget->InputCollisionData = InputCollisionData;
 		SwapKeysWidget->SetCallback(DecidedCallback);
 		UINavPC->GoToBuiltWidget(SwapKeysWidget, false, false, SpawnKeysWidgetZOrder);
@@ -80,12 +133,32 @@ bool UUINavInputContainer::RequestKeySwap(const FInputCollisionData& InputCollis
 
 void UUINavInputContainer::ResetKeyMappings()
 {
-	UUINavBlueprintFunctionLibrary::ResetInputSettings(Cast<APlayerController>(UINavPC->GetOwner()));
-	for (UUINavInputBox* InputBox : InputBoxes) InputBox->ResetKeyWidgets();
+	// Only the boxes whose actions were actually reset need updating
+	TArray<const UInputAction*> ResetActions;
+	UINavPC->ResetBindingsToDefault(nullptr, nullptr, ResetActions);
+	RefreshActionsKeys(ResetActions);
+}
+
+void UUINavInputContainer::RefreshActionsKeys(const TArray<const UInputAction*>& Actions)
+{
+	for (UUINavInputBox* InputBox : InputBoxes)
+	{
+		if (Actions.Contains(InputBox->InputActionData.Action)) InputBox->ResetKeyWidgets();
+	}
+	for (UInputBoxData* InputBoxData : InputBoxesData)
+	{
+		if (Actions.Contains(InputBoxData->InputActionData.Action)) RefreshInputBoxData(InputBoxData);
+	}
 }
 
 UUINavInputBox* UUINavInputContainer::GetInputBoxAtIndex(const int Index) const
 {
+	if (IsVirtualized())
+	{
+		const int DataIndex = Index == -1 ? InputBoxesData.Num() - 1 : Index;
+		return InputBoxesData.IsValidIndex(DataIndex) ? InputBoxesList->GetEntryWidgetFromItem<UUINavInputBox>(InputBoxesData[DataIndex]) : nullptr;
+	}
+
 	if (Index == -1 && InputBoxes.Num() > 0)
 	{
 		return InputBoxes.Last();
@@ -104,6 +177,9 @@ void UUINavInputContainer::SetupInputBoxes()
 	if (InputBox_BP == nullptr) return;
 
 	InputBoxes.Reset();
+	InputBoxesData.Reset();
+	KeyActionIndices.Reset();
+	NumPendingInputBoxesData = 0;
 
 	NumberOfInputs = 0;
 	for (const TPair<UInputMappingContext*, FInputContainerEnhancedActionDataArray>& Context : EnhancedInputs)
@@ -116,52 +192,249 @@ void UUINavInputContainer::SetupInputBoxes()
 		DISPLAYERROR(TEXT("Input Container has no Enhanced Input data!"));
 		return;
 	}
+
+	if (IsVirtualized())
+	{
+		CreateInputBoxesData();
+		return;
+	}
 	
 	CreateInputBoxes();
 }
 
-void UUINavInputContainer::CreateInputBoxes()
+void UUINavInputContainer::CreateInputBoxesData()
 {
-	if (InputBox_BP == nullptr) return;
-
-	APlayerController* PC = Cast<APlayerController>(UINavPC->GetOwner());
-	for (int i = 0; i < NumberOfInputs; ++i)
+	for (const TPair<UInputMappingContext*, FInputContainerEnhancedActionDataArray>& Context : EnhancedInputs)
 	{
-		UUINavInputBox* NewInputBox = CreateWidget<UUINavInputBox>(this, InputBox_BP);
-		InputBoxes.Add(NewInputBox);
-		NewInputBox->Container = this;
-		NewInputBox->KeysPerInput = KeysPerInput;
-
-		int Index = i;
-		for (const TPair<UInputMappingContext*, FInputContainerEnhancedActionDataArray>& Context : EnhancedInputs)
+		for (const FInputContainerEnhancedActionData& ActionData : Context.Value.Actions)
 		{
-			if (Index >= Context.Value.Actions.Num())
+			UInputBoxData* NewInputBoxData = NewObject<UInputBoxData>(this);
+			NewInputBoxData->Container = this;
+			NewInputBoxData->InputContext = Context.Key;
+			NewInputBoxData->InputActionData = ActionData;
+			if (NewInputBoxData->InputActionData.DisplayName.IsEmpty() && IsValid(ActionData.Action))
 			{
-				Index -= Context.Value.Actions.Num();
+				NewInputBoxData->InputActionData.DisplayName = FText::FromName(ActionData.Action->GetFName());
 			}
-			else
+			NewInputBoxData->EnhancedInputGroups = Context.Value.InputGroups;
+			if (NewInputBoxData->EnhancedInputGroups.Num() == 0)
 			{
-				NewInputBox->InputContext = Context.Key;
-				NewInputBox->InputActionData = Context.Value.Actions[Index];
-				NewInputBox->EnhancedInputGroups = Context.Value.InputGroups;
-				break;
+				NewInputBoxData->EnhancedInputGroups.Add(-1);
 			}
+			NewInputBoxData->Index = InputBoxesData.Add(NewInputBoxData);
 		}
 	}
 
+	NumPendingInputBoxesData = InputBoxesData.Num();
+
+	if (!IsValid(DetachedInputBox))
+	{
+		DetachedInputBox = CreateWidget<UUINavInputBox>(this, InputBox_BP);
+	}
+
+	// The displayed rows compute their own keys as the list view creates their entries
+	InputBoxesList->SetListItems(InputBoxesData);
+
+	FinishCreatingInputBoxes();
+}
+
+void UUINavInputContainer::RefreshInputBoxData(UInputBoxData* InputBoxData)
+{
+	UUINavInputBox* const EntryInputBox = InputBoxesList->GetEntryWidgetFromItem<UUINavInputBox>(InputBoxData);
+	if (!IsValid(EntryInputBox) && !InputBoxData->bKeysComputed)
+	{
+		// Still computed when it's first needed
+		return;
+	}
+
+	ComputeInputBoxData(InputBoxData);
+
+	if (IsValid(EntryInputBox))
+	{
+		EntryInputBox->SetInputBoxData(InputBoxData);
+		EntryInputBox->CreateKeyWidgetsFromData();
+	}
+}
+
+void UUINavInputContainer::ComputeInputBoxData(UInputBoxData* InputBoxData) const
+{
+	// Compute the action's keys without creating a widget for it
+	DetachedInputBox->SetInputBoxData(InputBoxData);
+	DetachedInputBox->CreateKeyWidgets();
+}
+
+void UUINavInputContainer::ComputePendingInputBoxesData() const
+{
+	if (NumPendingInputBoxesData == 0)
+	{
+		return;
+	}
+
+	for (UInputBoxData* const InputBoxData : InputBoxesData)
+	{
+		if (!InputBoxData->bKeysComputed)
+		{
+			ComputeInputBoxData(InputBoxData);
+		}
+	}
+}
+
+void UUINavInputContainer::StoreInputBoxDataKeys(UInputBoxData* InputBoxData, const TArray<FKey>& NewKeys)
+{
+	if (InputBoxData->bKeysComputed)
+	{
+		for (const FKey& OldKey : InputBoxData->Keys)
+		{
+			TArray<int32>* const ActionIndices = KeyActionIndices.Find(OldKey);
+			if (ActionIndices != nullptr)
+			{
+				ActionIndices->Remove(InputBoxData->Index);
+				if (ActionIndices->Num() == 0)
+				{
+					KeyActionIndices.Remove(OldKey);
+				}
+			}
+		}
+	}
+	else
+	{
+		InputBoxData->bKeysComputed = true;
+		--NumPendingInputBoxesData;
+	}
+
+	InputBoxData->Keys = NewKeys;
+	for (const FKey& NewKey : NewKeys)
+	{
+		if (NewKey.IsValid())
+		{
+			KeyActionIndices.FindOrAdd(NewKey).AddUnique(InputBoxData->Index);
+		}
+	}
+}
+
+UUINavInputBox* UUINavInputContainer::GetOffscreenInputBox(UInputBoxData* InputBoxData)
+{
+	if (!IsValid(OffscreenInputBox))
+	{
+		OffscreenInputBox = CreateWidget<UUINavInputBox>(this, InputBox_BP);
+	}
+
+	if (!InputBoxData->bKeysComputed)
+	{
+		ComputeInputBoxData(InputBoxData);
+	}
+
+	OffscreenInputBox->SetInputBoxData(InputBoxData);
+	OffscreenInputBox->CreateKeyWidgetsFromData();
+	return OffscreenInputBox;
+}
+
+int UUINavInputContainer::GetInputBoxIndex(const UUINavInputBox* InputBox) const
+{
+	if (IsVirtualized())
+	{
+		return IsValid(InputBox) && IsValid(InputBox->InputBoxData) ? InputBox->InputBoxData->Index : INDEX_NONE;
+	}
+
+	return InputBoxes.IndexOfByKey(InputBox);
+}
+
+UUINavInputBox* UUINavInputContainer::GetInputBoxForAction(const int Index)
+{
+	if (!IsVirtualized())
+	{
+		return InputBoxes.IsValidIndex(Index) ? InputBoxes[Index] : nullptr;
+	}
+
+	if (!InputBoxesData.IsValidIndex(Index))
+	{
+		return nullptr;
+	}
+
+	UUINavInputBox* EntryInputBox = InputBoxesList->GetEntryWidgetFromItem<UUINavInputBox>(InputBoxesData[Index]);
+	return IsValid(EntryInputBox) ? EntryInputBox : GetOffscreenInputBox(InputBoxesData[Index]);
+}
+
+void UUINavInputContainer::CreateInputBoxes()
+{
+	if (InputBox_BP == nullptr) return;
+
+	if (bTimeSliceInputBoxCreation)
+	{
+		bCreatingInputBoxes = true;
+		CreateInputBoxesWithinBudget();
+		return;
+	}
+
 	for (int i = 0; i < NumberOfInputs; ++i)
 	{
-		UUINavInputBox* const InputBox = InputBoxes[i];
-		InputBox->CreateKeyWidgets();
-		OnAddInputBox(InputBox);
+		CreateInputBox(i);
 	}
+
+	FinishCreatingInputBoxes();
+}
+
+void UUINavInputContainer::CreateInputBox(const int Index)
+{
+	UUINavInputBox* NewInputBox = CreateWidget<UUINavInputBox>(this, InputBox_BP);
+	InputBoxes.Add(NewInputBox);
+	NewInputBox->Container = this;
+	NewInputBox->KeysPerInput = KeysPerInput;
+
+	int ActionIndex = Index;
+	for (const TPair<UInputMappingContext*, FInputContainerEnhancedActionDataArray>& Context : EnhancedInputs)
+	{
+		if (ActionIndex >= Context.Value.Actions.Num())
+		{
+			ActionIndex -= Context.Value.Actions.Num();
+		}
+		else
+		{
+			NewInputBox->InputContext = Context.Key;
+			NewInputBox->InputActionData = Context.Value.Actions[ActionIndex];
+			NewInputBox->EnhancedInputGroups = Context.Value.InputGroups;
+			break;
+		}
+	}
+
+	NewInputBox->CreateKeyWidgets();
+	OnAddInputBox(NewInputBox);
+}
+
+void UUINavInputContainer::CreateInputBoxesWithinBudget()
+{
+	const double EndTime = FPlatformTime::Seconds() + InputBoxCreationBudgetMs / 1000.0;
+
+	/*
+	Boxes are created in panel order rather than starting from the scroll offset. InputBoxes is indexed by action,
+	OnAddInputBox appends to the panel (and may be overridden to do so), and the boxes' height isn't known until
+	they're laid out, so the visible range can't be found beforehand. A newly created container is scrolled to the top,
+	so panel order already creates the visible boxes first. Virtualized containers only build the displayed rows.
+	*/
+
+	// Always create at least one input box per frame, so that the container is guaranteed to finish
+	do
+	{
+		CreateInputBox(InputBoxes.Num());
+	} while (InputBoxes.Num() < NumberOfInputs && FPlatformTime::Seconds() < EndTime);
+
+	if (InputBoxes.Num() >= NumberOfInputs)
+	{
+		FinishCreatingInputBoxes();
+	}
+}
+
+void UUINavInputContainer::FinishCreatingInputBoxes()
+{
+	bCreatingInputBoxes = false;
+	OnInputBoxesCreated.Broadcast();
 }
 
 ERevertRebindReason UUINavInputContainer::CanRegisterKey(UUINavInputBox * InputBox, const FKey NewKey, const int Index, int& OutCollidingActionIndex, int& OutCollidingKeyIndex)
 {
 	if (!NewKey.IsValid()) return ERevertRebindReason::BlacklistedKey;
-	if (KeyWhitelist.Num() > 0 && !KeyWhitelist.Contains(NewKey)) return ERevertRebindReason::NonWhitelistedKey;
-	if (KeyBlacklist.Contains(NewKey)) return ERevertRebindReason::BlacklistedKey;
+	if (KeyWhitelistSet.Num() > 0 && !KeyWhitelistSet.Contains(NewKey)) return ERevertRebindReason::NonWhitelistedKey;
+	if (KeyBlacklistSet.Contains(NewKey)) return ERevertRebindReason::BlacklistedKey;
 	if (!RespectsRestriction(NewKey, Index)) return ERevertRebindReason::RestrictionMismatch;
 	if (InputBox->ContainsKey(NewKey) != INDEX_NONE) return ERevertRebindReason::UsedBySameInput;
 	if (!CanUseKey(InputBox, NewKey, OutCollidingActionIndex, OutCollidingKeyIndex)) return ERevertRebindReason::UsedBySameInputGroup;
@@ -173,6 +446,38 @@ bool UUINavInputContainer::CanUseKey(UUINavInputBox* InputBox, const FKey Compar
 {
 	if (InputBox->EnhancedInputGroups.Num() == 0) InputBox->EnhancedInputGroups.Add(-1);
 
+	if (IsVirtualized())
+	{
+		// Every action's keys are needed to find collisions, including the ones that were never displayed
+		ComputePendingInputBoxesData();
+
+		const TArray<int32>* const ActionIndices = KeyActionIndices.Find(CompareKey);
+		if (ActionIndices == nullptr)
+		{
+			return true;
+		}
+
+		for (const int32 i : *ActionIndices)
+		{
+			const UInputBoxData* const InputBoxData = InputBoxesData[i];
+			if (InputBox->InputBoxData == InputBoxData) continue;
+
+			const int KeyIndex = InputBoxData->Keys.IndexOfByKey(CompareKey);
+			if (KeyIndex == INDEX_NONE) continue;
+
+			if (InputBox->EnhancedInputGroups.Contains(-1) ||
+				InputBoxData->EnhancedInputGroups.Contains(-1) ||
+				InputBox->EnhancedInputGroups.ContainsByPredicate([InputBoxData](const int InputGroup) { return InputBoxData->EnhancedInputGroups.Contains(InputGroup); }))
+			{
+				OutCollidingActionIndex = i;
+				OutCollidingKeyIndex = KeyIndex;
+				return false;
+			}
+		}
+
+		return true;
+	}
+
 	for (int i = 0; i < InputBoxes.Num(); ++i)
 	{
 		if (InputBox == InputBoxes[i]) continue;
@@ -205,13 +510,74 @@ bool UUINavInputContainer::CanUseKey(UUINavInputBox* InputBox, const FKey Compar
 
 bool UUINavInputContainer::RespectsRestriction(const FKey CompareKey, const int Index)
 {
+	if (ColumnAllowedKeysIndices.IsValidIndex(Index))
+	{
+		if (RestrictionAllowedKeys[ColumnAllowedKeysIndices[Index]].Contains(CompareKey))
+		{
+			return true;
+		}
+
+		// Keys added after the cache was built, such as ones registered by plugins, weren't classified yet
+		if (CachedKeys.Contains(CompareKey))
+		{
+			return false;
+		}
+	}
+
 	const EInputRestriction Restriction = InputRestrictions[Index];
 
 	return UUINavBlueprintFunctionLibrary::RespectsRestriction(CompareKey, Restriction);
 }
 
+void UUINavInputContainer::CacheAllowedKeys()
+{
+	KeyWhitelistSet = TSet<FKey>(KeyWhitelist);
+	KeyBlacklistSet = TSet<FKey>(KeyBlacklist);
+
+	TArray<FKey> AllKeys;
+	EKeys::GetAllKeys(AllKeys);
+	CachedKeys = TSet<FKey>(AllKeys);
+
+	// Columns often share the same restriction, so each restriction's keys are only gathered and stored once
+	TMap<EInputRestriction, int32> RestrictionIndices;
+	RestrictionAllowedKeys.Reset();
+	ColumnAllowedKeysIndices.Reset(InputRestrictions.Num());
+	for (int i = 0; i < InputRestrictions.Num(); ++i)
+	{
+		const EInputRestriction Restriction = InputRestrictions[i];
+		if (const int32* const RestrictionIndex = RestrictionIndices.Find(Restriction))
+		{
+			ColumnAllowedKeysIndices.Add(*RestrictionIndex);
+			continue;
+		}
+
+		const int32 RestrictionIndex = RestrictionAllowedKeys.AddDefaulted();
+		RestrictionIndices.Add(Restriction, RestrictionIndex);
+		ColumnAllowedKeysIndices.Add(RestrictionIndex);
+		TSet<FKey>& AllowedKeys = RestrictionAllowedKeys[RestrictionIndex];
+		AllowedKeys.Reserve(AllKeys.Num());
+		for (const FKey& Key : AllKeys)
+		{
+			if (UUINavBlueprintFunctionLibrary::RespectsRestriction(Key, Restriction))
+			{
+				AllowedKeys.Add(Key);
+			}
+		}
+	}
+}
+
 void UUINavInputContainer::ResetInputBox(const FName InputName, const EAxisType AxisType)
 {
+	for (UInputBoxData* InputBoxData : InputBoxesData)
+	{
+		if (InputBoxData->InputActionData.Action->GetFName().IsEqual(InputName) &&
+			InputBoxData->GetAxisType() == AxisType)
+		{
+			RefreshInputBoxData(InputBoxData);
+			break;
+		}
+	}
+
 	for (UUINavInputBox* InputBox : InputBoxes)
 	{
 		if (InputBox->InputName.IsEqual(InputName) &&
@@ -230,10 +596,13 @@ void UUINavInputContainer::SwapKeysDecided(const UPromptDataBase* const PromptDa
 	{
 		if (SwapKeysPromptData->bShouldSwap)
 		{
+			// Both keys change together, so only rebuild the mappings once
+			UINavPC->BeginBindingTransaction();
 			SwapKeysPromptData->CurrentInputBox->FinishUpdateNewKey();
 			SwapKeysPromptData->CollidingInputBox->UpdateInputKey(SwapKeysPromptData->InputCollisionData.CurrentInputKey,
 				SwapKeysPromptData->InputCollisionData.CollidingKeyIndex,
 				true);
+			UINavPC->CommitBindingTransaction(true);
 		}
 		else
 		{
@@ -249,8 +618,8 @@ UUINavInputBox* UUINavInputContainer::GetInputBoxInDirection(UUINavInputBox* Inp
 		return nullptr;
 	}
 
-	int Index;
-	if (!InputBoxes.Find(InputBox, Index))
+	int Index = GetInputBoxIndex(InputBox);
+	if (Index == INDEX_NONE)
 	{
 		return nullptr;
 	}
@@ -267,6 +636,18 @@ UUINavInputBox* UUINavInputContainer::GetInputBoxInDirection(UUINavInputBox* Inp
 			return nullptr;
 	}
 
+	if (IsVirtualized())
+	{
+		if (!InputBoxesData.IsValidIndex(Index))
+		{
+			return nullptr;
+		}
+
+		// Make sure the list keeps generating the rows the player is navigating to
+		InputBoxesList->ScrollIndexIntoView(Index);
+		return InputBoxesList->GetEntryWidgetFromItem<UUINavInputBox>(InputBoxesData[Index]);
+	}
+
 	return InputBoxes.IsValidIndex(Index) ? InputBoxes[Index] : nullptr;
 }
 
@@ -274,10 +655,7 @@ UUINavInputBox* UUINavInputContainer::GetOppositeInputBox(const FInputContainerE
 {
 	for (UUINavInputBox* InputBox : InputBoxes)
 	{
-		if (InputBox->InputActionData.Action == ActionData.Action &&
-			InputBox->InputActionData.Axis == ActionData.Axis &&
-			((InputBox->InputActionData.AxisScale == EAxisType::Positive && ActionData.AxisScale == EAxisType::Negative) ||
-			(InputBox->InputActionData.AxisScale == EAxisType::Negative && ActionData.AxisScale == EAxisType::Positive)))
+		if (AreOppositeInputActions(ActionData, InputBox->InputActionData))
 		{
 			return InputBox;
 		}
@@ -286,73 +664,66 @@ UUINavInputBox* UUINavInputContainer::GetOppositeInputBox(const FInputContainerE
 	return nullptr;
 }
 
-UUINavInputBox* UUINavInputContainer::GetOppositeInputBox(const FName& InputName, const EAxisType AxisType)
+const FInputContainerEnhancedActionData* UUINavInputContainer::GetOppositeInputActionData(const FInputContainerEnhancedActionData& ActionData) const
 {
-	for (UUINavInputBox* InputBox : InputBoxes)
+	for (const TPair<UInputMappingContext*, FInputContainerEnhancedActionDataArray>& Context : EnhancedInputs)
 	{
-		if (InputBox->InputName == InputName &&
-			((InputBox->AxisType == EAxisType::Positive && AxisType == EAxisType::Negative) ||
-			(InputBox->AxisType == EAxisType::Negative && AxisType == EAxisType::Positive)))
+		for (const FInputContainerEnhancedActionData& OtherActionData : Context.Value.Actions)
 		{
-			return InputBox;
+			if (AreOppositeInputActions(ActionData, OtherActionData))
+			{
+				return &OtherActionData;
+			}
 		}
 	}
 
 	return nullptr;
 }
 
-void UUINavInputContainer::GetAxisPropertiesFromMapping(const FEnhancedActionKeyMapping& ActionMapping, bool& bOutPositive, EInputAxis& OutAxis) const
+FKey UUINavInputContainer::GetOppositeInputKey(const FInputContainerEnhancedActionData& ActionData, const int KeyIndex) const
 {
-	TArray<UInputModifier*> Modifiers(ActionMapping.Modifiers);
-	Modifiers.Append(ActionMapping.Action->Modifiers);
-	bOutPositive = true;
-	if (!UINavPC->IsAxis2D(ActionMapping.Key))
-	{
-		OutAxis = EInputAxis::X;
-	}
-	
-	for (const UInputModifier* Modifier : Modifiers)
+	if (IsVirtualized())
 	{
-		const UInputModifierSwizzleAxis* Swizzle = Cast<UInputModifierSwizzleAxis>(Modifier);
-		if (Swizzle != nullptr && !UINavPC->IsAxis2D(ActionMapping.Key))
+		for (const UInputBoxData* const InputBoxData : InputBoxesData)
 		{
-			switch(Swizzle->Order)
+			if (AreOppositeInputActions(ActionData, InputBoxData->InputActionData))
 			{
-			case EInputAxisSwizzle::YXZ:
-			case EInputAxisSwizzle::YZX:
-				OutAxis = EInputAxis::Y;
-				break;
-			case EInputAxisSwizzle::ZXY:
-			case EInputAxisSwizzle::ZYX:
-				OutAxis = EInputAxis::Z;
-				break;
+				return InputBoxData->Keys.IsValidIndex(KeyIndex) ? InputBoxData->Keys[KeyIndex] : FKey();
 			}
-			continue;
 		}
+
+		return FKey();
 	}
 
-	for (const UInputModifier* Modifier : Modifiers)
+	for (const UUINavInputBox* const InputBox : InputBoxes)
 	{
-		const UInputModifierNegate* Negate = Cast<UInputModifierNegate>(Modifier);
-		if (Negate != nullptr)
+		if (AreOppositeInputActions(ActionData, InputBox->InputActionData))
 		{
-			if (OutAxis == EInputAxis::X)
-			{
-				bOutPositive = !Negate->bX;
-			}
-			else if (OutAxis == EInputAxis::Y)
-			{
-				bOutPositive = !Negate->bY;
-			}
-			else if (OutAxis == EInputAxis::Z)
-			{
-				bOutPositive = !Negate->bZ;
-			}
-			continue;
+			return InputBox->GetKey(KeyIndex);
 		}
+	}
+
+	return FKey();
+}
 
-		// TODO: Add support for Scalar input modifier
+UUINavInputBox* UUINavInputContainer::GetOppositeInputBox(const FName& InputName, const EAxisType AxisType)
+{
+	for (UUINavInputBox* InputBox : InputBoxes)
+	{
+		if (InputBox->InputName == InputName && AreOppositeAxisTypes(InputBox->AxisType, AxisType))
+		{
+			return InputBox;
+		}
 	}
+
+	return nullptr;
+}
+
+void UUINavInputContainer::GetAxisPropertiesFromMapping(const FEnhancedActionKeyMapping& ActionMapping, bool& bOutPositive, EInputAxis& OutAxis) const
+{
+	const FIndexedActionMapping IndexedMapping(ActionMapping, INDEX_NONE, UINavPC->IsAxis2D(ActionMapping.Key));
+	OutAxis = IndexedMapping.GetAxis(OutAxis);
+	bOutPositive = IndexedMapping.IsPositive(OutAxis);
 }
 
 void UUINavInputContainer::GetInputRebindData(const int InputIndex, FInputRebindData& RebindData) const
@@ -365,6 +736,16 @@ void UUINavInputContainer::GetInputRebindData(const int InputIndex, FInputRebind
 
 void UUINavInputContainer::GetEnhancedInputRebindData(const int InputIndex, FInputRebindData& RebindData) const
 {
+	if (IsVirtualized())
+	{
+		if (InputBoxesData.IsValidIndex(InputIndex))
+		{
+			RebindData.InputText = InputBoxesData[InputIndex]->InputActionData.DisplayName;
+			RebindData.InputGroups = InputBoxesData[InputIndex]->EnhancedInputGroups;
+		}
+		return;
+	}
+
 	if (InputBoxes.IsValidIndex(InputIndex))
 	{
 		RebindData.InputText = InputBoxes[InputIndex]->InputText->GetText();
@@ -0,0 +1,140 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "UINavLazyWidget.h"
+#include "UINavWidget.h"
+#include "UINavMacros.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/PanelSlot.h"
+#include "Widgets/Layout/SBox.h"
+
+#define LOCTEXT_NAMESPACE "UINavigation"
+
+/**
+* A box that can be focused while it has no content, so that navigation can enter a lazy widget before it's built
+*/
+class SUINavLazyWidgetBox : public SBox
+{
+public:
+
+	FSimpleDelegate OnPlaceholderFocused;
+
+	bool bIsPlaceholder = false;
+
+	virtual bool SupportsKeyboardFocus() const override
+	{
+		return bIsPlaceholder;
+	}
+
+	virtual FReply OnFocusReceived(const FGeometry& MyGeometry, const FFocusEvent& InFocusEvent) override
+	{
+		if (bIsPlaceholder)
+		{
+			OnPlaceholderFocused.ExecuteIfBound();
+			return FReply::Handled();
+		}
+
+		return SBox::OnFocusReceived(MyGeometry, InFocusEvent);
+	}
+};
+
+UUINavWidget* UUINavLazyWidget::Build()
+{
+	if (IsValid(BuiltWidget))
+	{
+		return BuiltWidget;
+	}
+
+	if (WidgetClass == nullptr)
+	{
+		DISPLAYERROR("UINavLazyWidget doesn't have a Widget Class!");
+		return nullptr;
+	}
+
+	// Created in the same widget tree as this placeholder, so that the new widget finds its outer UINavWidget like any other nested widget
+	UWidgetTree* const OwnerWidgetTree = Cast<UWidgetTree>(GetOuter());
+	if (OwnerWidgetTree == nullptr)
+	{
+		DISPLAYERROR("UINavLazyWidget isn't in a widget tree!");
+		return nullptr;
+	}
+
+	BuiltWidget = CreateWidget<UUINavWidget>(OwnerWidgetTree, WidgetClass);
+	if (MyBox.IsValid())
+	{
+		MyBox->bIsPlaceholder = false;
+	}
+	SetContent(BuiltWidget);
+
+	// The owner's state widgets now include the built widget's
+	if (UUINavWidget* const OwnerWidget = UUINavWidget::GetOuterObject<UUINavWidget>(this))
+	{
+		OwnerWidget->InvalidateStateWidgets();
+	}
+
+	return BuiltWidget;
+}
+
+void UUINavLazyWidget::HandlePlaceholderFocused()
+{
+	if (UUINavWidget* const Widget = Build())
+	{
+		Widget->SetFocus();
+	}
+}
+
+TSharedRef<SWidget> UUINavLazyWidget::RebuildWidget()
+{
+	MyBox = SNew(SUINavLazyWidgetBox);
+	MyBox->OnPlaceholderFocused.BindUObject(this, &UUINavLazyWidget::HandlePlaceholderFocused);
+
+	if (GetChildrenCount() > 0)
+	{
+		UPanelSlot* const ContentSlot = GetContentSlot();
+		MyBox->SetContent(ContentSlot->Content != nullptr ? ContentSlot->Content->TakeWidget() : SNullWidget::NullWidget);
+	}
+	else if (!IsDesignTime())
+	{
+		MyBox->bIsPlaceholder = true;
+
+		if (UUINavWidget* const OwnerWidget = UUINavWidget::GetOuterObject<UUINavWidget>(this))
+		{
+			OwnerWidget->RegisterLazyWidget(this);
+		}
+	}
+
+	return MyBox.ToSharedRef();
+}
+
+void UUINavLazyWidget::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+
+	MyBox.Reset();
+}
+
+void UUINavLazyWidget::OnSlotAdded(UPanelSlot* InSlot)
+{
+	if (MyBox.IsValid())
+	{
+		MyBox->SetContent(InSlot->Content != nullptr ? InSlot->Content->TakeWidget() : SNullWidget::NullWidget);
+	}
+}
+
+void UUINavLazyWidget::OnSlotRemoved(UPanelSlot* InSlot)
+{
+	if (MyBox.IsValid())
+	{
+		MyBox->SetContent(SNullWidget::NullWidget);
+	}
+}
+
+#if WITH_EDITOR
+
+const FText UUINavLazyWidget::GetPaletteCategory()
+{
+	return LOCTEXT("UINavigation", "UI Navigation");
+}
+
+#endif
+
+#undef LOCTEXT_NAMESPACE
@@ -14,6 +14,7 @@
 #include "Data/AxisType.h"
 #include "Data/InputIconMapping.h"
 #include "Data/InputNameMapping.h"
+#include "Data/InputBindingsSave.h"
 #include "UINavBlueprintFunctionLibrary.h"
 #include "UINavInputProcessor.h"
 #include "GenericPlatform/GenericPlatformInputDeviceMapper.h"
@@ -25,7 +26,17 @@
 #include "EnhancedInputLibrary.h"
 #include "EnhancedPlayerInput.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/ARFilter.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "Templates/SharedPointer.h"
+#include "Async/Async.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Engine/LocalPlayer.h"
+#include "InputModifiers.h"
+#include "InputTriggers.h"
 #include "Engine/GameViewportClient.h"
 #include "Internationalization/Internationalization.h"
 
@@ -104,121 +115,1164 @@ void UUINavPCComponent::BeginPlay()
 		FSlateApplication::Get().RegisterInputPreProcessor(SharedInputProcessor);
 
 		CacheGameInputContexts();
-		TryResetDefaultInputs();
+
+		PrewarmConfiguredWidgets();
+
+		const UUINavSettings* const UINavSettings = GetDefault<UUINavSettings>();
+		if (UINavSettings->bRecordNavigationTelemetry)
+		{
+			TelemetryBuffer = MakeUnique<FNavigationTelemetryBuffer>(static_cast<uint32>(FMath::Max(UINavSettings->NavigationTelemetryCapacity, 2)));
+			TelemetryFlushCountdown = UINavSettings->NavigationTelemetryFlushInterval;
+		}
 
 		IPlatformInputDeviceMapper& PlatformInputMapper = IPlatformInputDeviceMapper::Get();
 		if (!PlatformInputMapper.GetOnInputDeviceConnectionChange().IsBoundToObject(this))
 		{
-			PlatformInputMapper.GetOnInputDeviceConnectionChange().AddUObject(this, &UUINavPCComponent::OnControllerConnectionChanged);
+			PlatformInputMapper.GetOnInputDeviceConnectionChange().AddUObject(this, &UUINavPCComponent::OnControllerConnectionChanged);
+		}
+	}
+}
+
+void UUINavPCComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (PC != nullptr && PC->IsLocalPlayerController())
+	{
+		FSlateApplication::Get().UnregisterInputPreProcessor(SharedInputProcessor);
+	}
+
+	if (InputContextsLoadHandle.IsValid())
+	{
+		InputContextsLoadHandle->CancelHandle();
+		InputContextsLoadHandle.Reset();
+	}
+
+	if (PrewarmLoadHandle.IsValid())
+	{
+		PrewarmLoadHandle->CancelHandle();
+		PrewarmLoadHandle.Reset();
+	}
+	PrewarmedWidgets.Empty();
+	NavigationStack.Empty();
+
+	// The player's copies are owned by this component, so they mustn't outlive it in the subsystem
+	RestoreOriginalInputContexts();
+
+	for (UUINavWidget* const Widget : TeardownQueue)
+	{
+		if (IsValid(Widget))
+		{
+			Widget->FinishTeardown();
+		}
+	}
+	TeardownQueue.Empty();
+
+	if (BindingsSaveCountdown >= 0.0f)
+	{
+		SaveInputBindings(true);
+	}
+	else if (BindingsSaveTask.IsValid())
+	{
+		BindingsSaveTask.Wait();
+	}
+
+	if (TelemetryBuffer.IsValid())
+	{
+		if (GetDefault<UUINavSettings>()->bWriteNavigationTelemetryToFile)
+		{
+			FlushNavigationTelemetry(true);
+		}
+		else if (TelemetryFlushTask.IsValid())
+		{
+			TelemetryFlushTask.Wait();
+		}
+		TelemetryBuffer.Reset();
+	}
+	
+	IPlatformInputDeviceMapper::Get().GetOnInputDeviceConnectionChange().RemoveAll(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UUINavPCComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	switch (CountdownPhase)
+	{
+		case ECountdownPhase::First:
+			TimerCounter += DeltaTime;
+			if (TimerCounter >= InputHeldWaitTime)
+			{
+				NavigateInDirection(CallbackDirection);
+				TimerCounter -= InputHeldWaitTime;
+				CountdownPhase = ECountdownPhase::Looping;
+			}
+			break;
+		case ECountdownPhase::Looping:
+			TimerCounter += DeltaTime;
+			if (TimerCounter >= NavigationChainFrequency)
+			{
+				NavigateInDirection(CallbackDirection);
+				TimerCounter -= NavigationChainFrequency;
+			}
+			break;
+	}
+
+	if (!bReceivedAnalogInput)
+	{
+		ThumbstickDelta = FVector2D::ZeroVector;
+	}
+	else
+	{
+		bReceivedAnalogInput = false;
+	}
+
+	if (bIgnoreFocusByNavigation)
+	{
+		bIgnoreFocusByNavigation = false;
+	}
+
+	if (UsingThumbstickAsMouse() != EThumbstickAsMouse::None != bUsingThumbstickAsMouse)
+	{
+		bUsingThumbstickAsMouse = !bUsingThumbstickAsMouse;
+		RefreshNavigationKeys();
+	}
+
+	if (BindingsSaveCountdown >= 0.0f)
+	{
+		BindingsSaveCountdown -= DeltaTime;
+		if (BindingsSaveCountdown < 0.0f)
+		{
+			SaveInputBindings();
+		}
+	}
+
+	if (TeardownQueue.Num() > 0)
+	{
+		ProcessTeardownQueue();
+	}
+
+	if (TelemetryBuffer.IsValid() && GetDefault<UUINavSettings>()->bWriteNavigationTelemetryToFile)
+	{
+		TelemetryFlushCountdown -= DeltaTime;
+		if (TelemetryFlushCountdown <= 0.0f)
+		{
+			TelemetryFlushCountdown = GetDefault<UUINavSettings>()->NavigationTelemetryFlushInterval;
+			FlushNavigationTelemetry();
+		}
+	}
+}
+
+void UUINavPCComponent::RequestRebuildMappings()
+{
+	ActionIndices.Empty();
+
+	if (IsInBindingTransaction())
+	{
+		bRebuildMappingsPending = true;
+		return;
+	}
+
+	MarkInputBindingsDirty();
+
+	// Each player modifies their own copies of the input contexts, so only their subsystem needs rebuilding
+	if (UEnhancedInputLocalPlayerSubsystem* const Subsystem = GetEnhancedInputSubsystem())
+	{
+		UsePlayerInputContexts(Subsystem);
+		Subsystem->RequestRebuildControlMappings();
+	}
+}
+
+void UUINavPCComponent::RebuildMappingsForContexts(const TArray<UInputMappingContext*>& InputContexts)
+{
+	MarkInputBindingsDirty();
+
+	for (const UInputMappingContext* const InputContext : InputContexts)
+	{
+		ActionIndices.Remove(InputContext);
+	}
+
+	UEnhancedInputLocalPlayerSubsystem* const Subsystem = GetEnhancedInputSubsystem();
+	if (Subsystem == nullptr)
+	{
+		return;
+	}
+
+	UsePlayerInputContexts(Subsystem);
+	int32 Priority = 0;
+	if (InputContexts.ContainsByPredicate([this, &Priority](const UInputMappingContext* InputContext) { return HasPlayerInputContext(InputContext, Priority); }))
+	{
+		Subsystem->RequestRebuildControlMappings();
+	}
+}
+
+UEnhancedInputLocalPlayerSubsystem* UUINavPCComponent::GetEnhancedInputSubsystem() const
+{
+	return PC != nullptr ? ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PC->GetLocalPlayer()) : nullptr;
+}
+
+void UUINavPCComponent::BuildActionIndex(const UInputMappingContext* InputContext, FMappingContextActionIndex& OutActionIndex) const
+{
+	const TArray<FEnhancedActionKeyMapping>& Mappings = InputContext->GetMappings();
+	for (int32 i = 0; i < Mappings.Num(); ++i)
+	{
+		const FEnhancedActionKeyMapping& Mapping = Mappings[i];
+		if (Mapping.Action != nullptr)
+		{
+			OutActionIndex.ActionMappings.FindOrAdd(Mapping.Action).Emplace(Mapping, i, IsAxis2D(Mapping.Key));
+		}
+	}
+
+	for (TPair<TObjectKey<UInputAction>, TArray<FIndexedActionMapping>>& ActionMappings : OutActionIndex.ActionMappings)
+	{
+		LinkOppositeMappings(Mappings, ActionMappings.Value);
+	}
+}
+
+void UUINavPCComponent::LinkOppositeMappings(const TArray<FEnhancedActionKeyMapping>& Mappings, TArray<FIndexedActionMapping>& IndexedMappings) const
+{
+	for (FIndexedActionMapping& IndexedMapping : IndexedMappings)
+	{
+		bool bIsOppositeKeyPositive = false;
+		const FKey OppositeKey = GetOppositeAxisKey(Mappings[IndexedMapping.MappingIndex].Key, bIsOppositeKeyPositive);
+		const FIndexedActionMapping* const OppositeMapping = OppositeKey.IsValid() ?
+			IndexedMappings.FindByPredicate([&Mappings, &OppositeKey](const FIndexedActionMapping& Other) { return Mappings[Other.MappingIndex].Key == OppositeKey; }) :
+			nullptr;
+		IndexedMapping.OppositeMappingIndex = OppositeMapping != nullptr ? OppositeMapping->MappingIndex : INDEX_NONE;
+	}
+}
+
+TArrayView<const FIndexedActionMapping> UUINavPCComponent::GetIndexedActionMappings(const UInputMappingContext* InputContext, const UInputAction* Action) const
+{
+	FMappingContextActionIndex* ActionIndex = ActionIndices.Find(InputContext);
+	if (ActionIndex == nullptr)
+	{
+		ActionIndex = &ActionIndices.Add(InputContext);
+		if (IsValid(InputContext))
+		{
+			BuildActionIndex(InputContext, *ActionIndex);
+		}
+	}
+
+	return ActionIndex->GetActionMappings(Action);
+}
+
+void UUINavPCComponent::SetMappingKey(UInputMappingContext* InputContext, const int32 MappingIndex, const FKey& NewKey)
+{
+	FEnhancedActionKeyMapping& Mapping = InputContext->GetMapping(MappingIndex);
+	Mapping.Key = NewKey;
+
+	// Only the mapping's own entry and the links between the action's opposite mappings depend on the key
+	FMappingContextActionIndex* const ActionIndex = ActionIndices.Find(InputContext);
+	TArray<FIndexedActionMapping>* const IndexedMappings = ActionIndex != nullptr ? ActionIndex->ActionMappings.Find(Mapping.Action) : nullptr;
+	if (IndexedMappings == nullptr)
+	{
+		return;
+	}
+
+	for (FIndexedActionMapping& IndexedMapping : *IndexedMappings)
+	{
+		if (IndexedMapping.MappingIndex == MappingIndex)
+		{
+			IndexedMapping = FIndexedActionMapping(Mapping, MappingIndex, IsAxis2D(NewKey));
+			break;
+		}
+	}
+	LinkOppositeMappings(InputContext->GetMappings(), *IndexedMappings);
+}
+
+FEnhancedActionKeyMapping& UUINavPCComponent::MapContextKey(UInputMappingContext* InputContext, const UInputAction* Action, const FKey& Key)
+{
+	ActionIndices.Remove(InputContext);
+	return InputContext->MapKey(Action, Key);
+}
+
+void UUINavPCComponent::UnmapContextKey(UInputMappingContext* InputContext, const UInputAction* Action, const FKey& Key)
+{
+	ActionIndices.Remove(InputContext);
+	InputContext->UnmapKey(Action, Key);
+}
+
+void UUINavPCComponent::UsePlayerInputContexts(UEnhancedInputLocalPlayerSubsystem* Subsystem)
+{
+	for (const TPair<const UInputMappingContext*, UInputMappingContext*>& PlayerInputContext : PlayerInputContexts)
+	{
+		int32 Priority = 0;
+		if (IsValid(PlayerInputContext.Key) && Subsystem->HasMappingContext(PlayerInputContext.Key, Priority))
+		{
+			Subsystem->RemoveMappingContext(PlayerInputContext.Key);
+			Subsystem->AddMappingContext(PlayerInputContext.Value, Priority);
+			PlayerInputContextPriorities.Add(PlayerInputContext.Key, Priority);
+		}
+	}
+}
+
+void UUINavPCComponent::RestoreOriginalInputContexts()
+{
+	UEnhancedInputLocalPlayerSubsystem* const Subsystem = GetEnhancedInputSubsystem();
+	if (Subsystem != nullptr)
+	{
+		for (const TPair<const UInputMappingContext*, int32>& ContextPriority : PlayerInputContextPriorities)
+		{
+			UInputMappingContext* const PlayerInputContext = PlayerInputContexts.FindRef(ContextPriority.Key);
+			if (IsValid(ContextPriority.Key) && PlayerInputContext != nullptr && Subsystem->HasMappingContext(PlayerInputContext))
+			{
+				Subsystem->RemoveMappingContext(PlayerInputContext);
+				Subsystem->AddMappingContext(ContextPriority.Key, ContextPriority.Value);
+			}
+		}
+	}
+
+	PlayerInputContextPriorities.Empty();
+}
+
+UInputMappingContext* UUINavPCComponent::GetPlayerInputContext(UInputMappingContext* InputContext) const
+{
+	UInputMappingContext* const PlayerInputContext = PlayerInputContexts.FindRef(InputContext);
+	return PlayerInputContext != nullptr ? PlayerInputContext : InputContext;
+}
+
+const UInputMappingContext* UUINavPCComponent::GetConstPlayerInputContext(const UInputMappingContext* InputContext) const
+{
+	const UInputMappingContext* const PlayerInputContext = PlayerInputContexts.FindRef(InputContext);
+	return PlayerInputContext != nullptr ? PlayerInputContext : InputContext;
+}
+
+void UUINavPCComponent::AddPlayerInputContext(UInputMappingContext* InputContext, const int32 Priority)
+{
+	UEnhancedInputLocalPlayerSubsystem* const Subsystem = GetEnhancedInputSubsystem();
+	if (!IsValid(InputContext) || Subsystem == nullptr)
+	{
+		return;
+	}
+
+	UInputMappingContext* const PlayerInputContext = GetPlayerInputContext(InputContext);
+	Subsystem->AddMappingContext(PlayerInputContext, Priority);
+	if (PlayerInputContext != InputContext)
+	{
+		PlayerInputContextPriorities.Add(InputContext, Priority);
+	}
+}
+
+void UUINavPCComponent::RemovePlayerInputContext(UInputMappingContext* InputContext)
+{
+	UEnhancedInputLocalPlayerSubsystem* const Subsystem = GetEnhancedInputSubsystem();
+	if (!IsValid(InputContext) || Subsystem == nullptr)
+	{
+		return;
+	}
+
+	// Whichever of the original context and the player's copy is in the subsystem
+	Subsystem->RemoveMappingContext(InputContext);
+	if (UInputMappingContext* const PlayerInputContext = PlayerInputContexts.FindRef(InputContext))
+	{
+		Subsystem->RemoveMappingContext(PlayerInputContext);
+	}
+	PlayerInputContextPriorities.Remove(InputContext);
+}
+
+bool UUINavPCComponent::HasPlayerInputContext(const UInputMappingContext* InputContext, int32& OutPriority) const
+{
+	const UEnhancedInputLocalPlayerSubsystem* const Subsystem = GetEnhancedInputSubsystem();
+	if (!IsValid(InputContext) || Subsystem == nullptr)
+	{
+		return false;
+	}
+
+	if (Subsystem->HasMappingContext(InputContext, OutPriority))
+	{
+		return true;
+	}
+
+	// The counterpart of an original context is the player's copy, and the other way around
+	const UInputMappingContext* Counterpart = PlayerInputContexts.FindRef(InputContext);
+	if (Counterpart == nullptr && InputContext->GetOuter() == this)
+	{
+		for (const TPair<const UInputMappingContext*, UInputMappingContext*>& PlayerInputContext : PlayerInputContexts)
+		{
+			if (PlayerInputContext.Value == InputContext)
+			{
+				Counterpart = PlayerInputContext.Key;
+				break;
+			}
+		}
+	}
+
+	return Counterpart != nullptr && Subsystem->HasMappingContext(Counterpart, OutPriority);
+}
+
+UInputMappingContext* UUINavPCComponent::GetMutableInputContext(UInputMappingContext* InputContext)
+{
+	if (!IsValid(InputContext) || InputContext->GetOuter() == this)
+	{
+		return InputContext;
+	}
+
+	if (UInputMappingContext* const FoundInputContext = PlayerInputContexts.FindRef(InputContext))
+	{
+		return FoundInputContext;
+	}
+
+	UInputMappingContext* const PlayerInputContext = DuplicateObject<UInputMappingContext>(InputContext, this);
+	PlayerInputContexts.Add(InputContext, PlayerInputContext);
+
+#if !UE_BUILD_SHIPPING
+	// A fresh copy holds duplicated modifiers and triggers, so it must still match its original by value
+	const FMappingContextSnapshot OriginalMappings(InputContext);
+	TArray<const UInputAction*> Actions;
+	OriginalMappings.GetActions(PlayerInputContext, Actions);
+	for (const UInputAction* const Action : Actions)
+	{
+		ensureMsgf(!OriginalMappings.ActionDiffers(PlayerInputContext, Action),
+			TEXT("The copy of %s differs from it in action %s before being modified"), *GetNameSafe(InputContext), *GetNameSafe(Action));
+	}
+#endif
+
+	if (UEnhancedInputLocalPlayerSubsystem* const Subsystem = GetEnhancedInputSubsystem())
+	{
+		UsePlayerInputContexts(Subsystem);
+	}
+
+	return PlayerInputContext;
+}
+
+void UUINavPCComponent::BeginBindingTransaction()
+{
+	++BindingTransactionDepth;
+}
+
+bool UUINavPCComponent::CommitBindingTransaction(const bool bAllowKeyConflicts /*= false*/)
+{
+	if (!IsInBindingTransaction())
+	{
+		DISPLAYERROR(TEXT("CommitBindingTransaction called without a matching BeginBindingTransaction!"));
+		return false;
+	}
+
+	if (--BindingTransactionDepth > 0)
+	{
+		return true;
+	}
+
+	if (!bAllowKeyConflicts)
+	{
+		for (const TPair<UInputMappingContext*, FMappingContextSnapshot>& Snapshot : BindingTransactionSnapshots)
+		{
+			if (IsValid(Snapshot.Key) && IntroducesKeyConflicts(Snapshot.Value.Mappings, Snapshot.Key->GetMappings()))
+			{
+				RevertBindingTransactionChanges();
+				return false;
+			}
+		}
+	}
+
+	TArray<const UInputAction*> ChangedActions;
+	GetBindingTransactionChangedActions(ChangedActions);
+
+	TArray<UInputMappingContext*> ModifiedContexts;
+	BindingTransactionSnapshots.GenerateKeyArray(ModifiedContexts);
+	BindingTransactionSnapshots.Empty();
+
+	if (ModifiedContexts.Num() > 0)
+	{
+		RebuildMappingsForContexts(ModifiedContexts);
+	}
+	else if (bRebuildMappingsPending)
+	{
+		RequestRebuildMappings();
+	}
+	bRebuildMappingsPending = false;
+
+	// Input boxes only know about the changes made through them
+	if (ChangedActions.Num() > 0)
+	{
+		BindingsChangedEvent.Broadcast(ChangedActions);
+	}
+
+	return true;
+}
+
+void UUINavPCComponent::RollbackBindingTransaction()
+{
+	if (!IsInBindingTransaction())
+	{
+		return;
+	}
+
+	BindingTransactionDepth = 0;
+	RevertBindingTransactionChanges();
+}
+
+void UUINavPCComponent::RevertBindingTransactionChanges()
+{
+	bRebuildMappingsPending = false;
+
+	TArray<const UInputAction*> RevertedActions;
+	GetBindingTransactionChangedActions(RevertedActions);
+
+	TArray<UInputMappingContext*> ModifiedContexts;
+	for (const TPair<UInputMappingContext*, FMappingContextSnapshot>& Snapshot : BindingTransactionSnapshots)
+	{
+		if (IsValid(Snapshot.Key))
+		{
+			Snapshot.Value.Restore(Snapshot.Key);
+			ModifiedContexts.Add(Snapshot.Key);
+		}
+	}
+	BindingTransactionSnapshots.Empty();
+
+	if (ModifiedContexts.Num() > 0)
+	{
+		RebuildMappingsForContexts(ModifiedContexts);
+	}
+
+	// Input boxes were already showing the new keys
+	if (RevertedActions.Num() > 0)
+	{
+		BindingsRevertedEvent.Broadcast(RevertedActions);
+	}
+}
+
+void UUINavPCComponent::GetBindingTransactionChangedActions(TArray<const UInputAction*>& OutActions) const
+{
+	for (const TPair<UInputMappingContext*, FMappingContextSnapshot>& Snapshot : BindingTransactionSnapshots)
+	{
+		if (!IsValid(Snapshot.Key))
+		{
+			continue;
+		}
+
+		TArray<const UInputAction*> Actions;
+		Snapshot.Value.GetActions(Snapshot.Key, Actions);
+		for (const UInputAction* const Action : Actions)
+		{
+			if (Snapshot.Value.ActionDiffers(Snapshot.Key, Action))
+			{
+				OutActions.AddUnique(Action);
+			}
+		}
+	}
+}
+
+bool UUINavPCComponent::RebindActionKey(UInputMappingContext* InputContext, const FInputContainerEnhancedActionData& ActionData, const FKey OldKey, const FKey NewKey)
+{
+	const UInputAction* const Action = ActionData.Action;
+
+	// Also covers both keys being invalid
+	if (!IsValid(InputContext) || !IsValid(Action) || OldKey == NewKey)
+	{
+		return false;
+	}
+
+	InputContext = GetMutableInputContext(InputContext);
+
+	const int32 MappingIndex = OldKey.IsValid() ?
+		InputContext->GetMappings().IndexOfByPredicate([Action, &OldKey](const FEnhancedActionKeyMapping& Mapping) { return Mapping.Action == Action && Mapping.Key == OldKey; }) :
+		INDEX_NONE;
+
+	if (OldKey.IsValid() && MappingIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	if (!OldKey.IsValid() &&
+		InputContext->GetMappings().ContainsByPredicate([Action, &NewKey](const FEnhancedActionKeyMapping& Mapping) { return Mapping.Action == Action && Mapping.Key == NewKey; }))
+	{
+		return false;
+	}
+
+	// The old mapping's negated axes, so that an inverted axis stays inverted when it's replaced by a key
+	bool bNegateX = false;
+	bool bNegateY = false;
+	bool bNegateZ = false;
+	if (MappingIndex != INDEX_NONE)
+	{
+		for (const FIndexedActionMapping& IndexedMapping : GetIndexedActionMappings(InputContext, Action))
+		{
+			if (IndexedMapping.MappingIndex == MappingIndex)
+			{
+				bNegateX = IndexedMapping.Scale.X < 0.0;
+				bNegateY = IndexedMapping.Scale.Y < 0.0;
+				bNegateZ = IndexedMapping.Scale.Z < 0.0;
+				break;
+			}
+		}
+	}
+
+	NotifyMappingContextModified(InputContext);
+
+	if (!NewKey.IsValid())
+	{
+		UnmapContextKey(InputContext, Action, OldKey);
+	}
+	else if (MappingIndex != INDEX_NONE && IsAxis(OldKey) == IsAxis(NewKey))
+	{
+		// The mapping's modifiers still select the same axis and direction
+		SetMappingKey(InputContext, MappingIndex, NewKey);
+	}
+	else
+	{
+		if (MappingIndex != INDEX_NONE)
+		{
+			UnmapContextKey(InputContext, Action, OldKey);
+		}
+
+		FEnhancedActionKeyMapping& NewMapping = MapContextKey(InputContext, Action, NewKey);
+		if (IsAxis(NewKey))
+		{
+			// An axis key covers both directions, so it only needs to be swizzled to the action's axis
+			FInputContainerEnhancedActionData AxisActionData = ActionData;
+			AxisActionData.AxisScale = EAxisType::None;
+			UUINavInputBox::AddRelevantModifiers(AxisActionData, NewMapping);
+		}
+		else
+		{
+			UUINavInputBox::AddRelevantModifiers(ActionData, NewMapping);
+			if (ActionData.AxisScale != EAxisType::None)
+			{
+				UUINavInputBox::ApplyNegateModifiers(ActionData, NewMapping, bNegateX, bNegateY, bNegateZ);
+			}
+		}
+	}
+
+	RequestRebuildMappings();
+
+	// Within a transaction, the changed actions are broadcast when it's committed
+	if (!IsInBindingTransaction())
+	{
+		BindingsChangedEvent.Broadcast({ Action });
+	}
+
+	return true;
+}
+
+void UUINavPCComponent::NotifyMappingContextModified(UInputMappingContext* InputContext)
+{
+	ActionIndices.Remove(InputContext);
+
+	if (IsInBindingTransaction() && IsValid(InputContext) && !BindingTransactionSnapshots.Contains(InputContext))
+	{
+		BindingTransactionSnapshots.Add(InputContext, FMappingContextSnapshot(InputContext));
+	}
+}
+
+void UUINavPCComponent::MarkInputBindingsDirty()
+{
+	const UUINavSettings* const UINavSettings = GetDefault<UUINavSettings>();
+	if (bInputContextsCached && UINavSettings->bSaveInputBindings)
+	{
+		BindingsSaveCountdown = FMath::Max(UINavSettings->InputBindingsSaveDelay, 0.0f);
+	}
+}
+
+FString UUINavPCComponent::GetInputBindingsSavePath() const
+{
+	const ULocalPlayer* const LocalPlayer = PC != nullptr ? PC->GetLocalPlayer() : nullptr;
+	const int32 PlayerIndex = LocalPlayer != nullptr ? LocalPlayer->GetLocalPlayerIndex() : 0;
+	return FPaths::ProjectSavedDir() / TEXT("UINavigation") / FString::Printf(TEXT("InputBindings_%d.bin"), PlayerIndex);
+}
+
+void UUINavPCComponent::LoadInputBindings()
+{
+	if (!GetDefault<UUINavSettings>()->bSaveInputBindings)
+	{
+		return;
+	}
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *GetInputBindingsSavePath(), FILEREAD_Silent))
+	{
+		return;
+	}
+
+	FInputBindingsSave BindingsSave;
+	if (!DeserializeInputBindings(Bytes, BindingsSave))
+	{
+		DISPLAYERROR(TEXT("The saved input bindings are corrupted or from a newer version!"));
+		return;
+	}
+
+	ApplyInputBindingChanges(BindingsSave);
+}
+
+void UUINavPCComponent::SaveInputBindings(const bool bWaitForWrite /*= false*/)
+{
+	// Only one write can be in flight, so that an older save never overwrites a newer one
+	if (BindingsSaveTask.IsValid())
+	{
+		if (!bWaitForWrite && !BindingsSaveTask.IsReady())
+		{
+			BindingsSaveCountdown = 0.0f;
+			return;
+		}
+
+		BindingsSaveTask.Wait();
+		BindingsSaveTask.Reset();
+	}
+
+	BindingsSaveCountdown = -1.0f;
+
+	FInputBindingsSave BindingsSave;
+	GatherInputBindingChanges(BindingsSave);
+
+	TArray<uint8> Bytes;
+	SerializeInputBindings(BindingsSave, Bytes);
+
+	FString SavePath = GetInputBindingsSavePath();
+	if (bWaitForWrite)
+	{
+		FFileHelper::SaveArrayToFile(Bytes, *SavePath);
+		return;
+	}
+
+	BindingsSaveTask = Async(EAsyncExecution::ThreadPool, [Bytes = MoveTemp(Bytes), SavePath = MoveTemp(SavePath)]()
+	{
+		return FFileHelper::SaveArrayToFile(Bytes, *SavePath);
+	});
+}
+
+FString UUINavPCComponent::GetNavigationTelemetryPath() const
+{
+	const ULocalPlayer* const LocalPlayer = PC != nullptr ? PC->GetLocalPlayer() : nullptr;
+	const int32 PlayerIndex = LocalPlayer != nullptr ? LocalPlayer->GetLocalPlayerIndex() : 0;
+	return FPaths::ProjectSavedDir() / TEXT("UINavigation") / FString::Printf(TEXT("NavigationTelemetry_%d.csv"), PlayerIndex);
+}
+
+void UUINavPCComponent::FlushNavigationTelemetry(const bool bWaitForWrite /*= false*/)
+{
+	if (TelemetryFlushTask.IsValid())
+	{
+		if (!bWaitForWrite && !TelemetryFlushTask.IsReady())
+		{
+			return;
+		}
+
+		TelemetryFlushTask.Wait();
+		TelemetryFlushTask.Reset();
+	}
+
+	// The buffer outlives the task, since it's only destroyed after waiting for it
+	FNavigationTelemetryBuffer* const Buffer = TelemetryBuffer.Get();
+	FString TelemetryPath = GetNavigationTelemetryPath();
+	auto WriteRecords = [Buffer, TelemetryPath = MoveTemp(TelemetryPath)]()
+	{
+		FString Lines;
+		Buffer->Drain([&Lines](const FNavigationTelemetryRecord& Record)
+		{
+			Lines += Record.ToString();
+			Lines += LINE_TERMINATOR;
+		});
+
+		const uint32 NumDropped = Buffer->ConsumeNumDropped();
+		if (NumDropped > 0)
+		{
+			Lines += FString::Printf(TEXT("%.6f,Dropped,,%u,0,0%s"), FPlatformTime::Seconds(), NumDropped, LINE_TERMINATOR);
+		}
+
+		if (!Lines.IsEmpty())
+		{
+			FFileHelper::SaveStringToFile(Lines, *TelemetryPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+		}
+	};
+
+	if (bWaitForWrite)
+	{
+		WriteRecords();
+		return;
+	}
+
+	TelemetryFlushTask = Async(EAsyncExecution::ThreadPool, MoveTemp(WriteRecords));
+}
+
+bool UUINavPCComponent::DrainNavigationTelemetry(TFunctionRef<void(const FNavigationTelemetryRecord&)> Callback)
+{
+	if (!TelemetryBuffer.IsValid() || (TelemetryFlushTask.IsValid() && !TelemetryFlushTask.IsReady()))
+	{
+		return false;
+	}
+
+	TelemetryBuffer->Drain(Callback);
+	return true;
+}
+
+void UUINavPCComponent::GatherInputBindingChanges(FInputBindingsSave& OutBindingsSave) const
+{
+	// Only the contexts this player modified can differ from the defaults
+	const UUINavDefaultInputSettings* const DefaultInputSettings = GetDefault<UUINavDefaultInputSettings>();
+	for (const TPair<const UInputMappingContext*, UInputMappingContext*>& PlayerInputContext : PlayerInputContexts)
+	{
+		const FMappingContextSnapshot* const DefaultMappings = DefaultInputSettings->GetDefaultMappings(PlayerInputContext.Key);
+		if (DefaultMappings == nullptr || !IsValid(PlayerInputContext.Value))
+		{
+			continue;
+		}
+
+		const TArray<FEnhancedActionKeyMapping>& Mappings = PlayerInputContext.Value->GetMappings();
+
+		TArray<const UInputAction*> Actions;
+		DefaultMappings->GetActions(PlayerInputContext.Value, Actions);
+
+		for (const UInputAction* const Action : Actions)
+		{
+			if (!IsValid(Action) || !DefaultMappings->ActionDiffers(PlayerInputContext.Value, Action))
+			{
+				continue;
+			}
+
+			FSavedActionBindings ActionBindings;
+			ActionBindings.ContextPath = FSoftObjectPath(PlayerInputContext.Key).ToString();
+			ActionBindings.ActionPath = FSoftObjectPath(Action).ToString();
+			for (const FEnhancedActionKeyMapping& Mapping : Mappings)
+			{
+				if (Mapping.Action != Action) continue;
+
+				FSavedInputMapping& SavedMapping = ActionBindings.Mappings.Emplace_GetRef(Mapping.Key.GetFName());
+				for (const UInputModifier* const Modifier : Mapping.Modifiers)
+				{
+					SavedMapping.AddModifier(Modifier);
+				}
+			}
+
+			OutBindingsSave.Actions.Add(MoveTemp(ActionBindings));
+		}
+	}
+}
+
+void UUINavPCComponent::ApplyInputBindingChanges(const FInputBindingsSave& BindingsSave)
+{
+	TArray<UInputMappingContext*> ModifiedContexts;
+	for (const FSavedActionBindings& ActionBindings : BindingsSave.Actions)
+	{
+		UInputMappingContext* const InputContext = GetMutableInputContext(Cast<UInputMappingContext>(FSoftObjectPath(ActionBindings.ContextPath).ResolveObject()));
+		const UInputAction* const Action = Cast<UInputAction>(FSoftObjectPath(ActionBindings.ActionPath).ResolveObject());
+		if (!IsValid(InputContext) || !IsValid(Action))
+		{
+			continue;
+		}
+
+		// Triggers and modifiers that weren't added by the rebinding process are kept from the replaced mappings
+		const TArray<FEnhancedActionKeyMapping> OldMappings = InputContext->GetMappings().FilterByPredicate([Action](const FEnhancedActionKeyMapping& Mapping) { return Mapping.Action == Action; });
+
+		InputContext->UnmapAllKeysFromAction(Action);
+		for (int i = 0; i < ActionBindings.Mappings.Num(); ++i)
+		{
+			const FSavedInputMapping& SavedMapping = ActionBindings.Mappings[i];
+			FEnhancedActionKeyMapping& NewMapping = InputContext->MapKey(Action, FKey(SavedMapping.Key));
+
+			if (OldMappings.Num() > 0)
+			{
+				const FEnhancedActionKeyMapping& OldMapping = OldMappings[FMath::Min(i, OldMappings.Num() - 1)];
+				NewMapping.Triggers = OldMapping.Triggers;
+				for (UInputModifier* const Modifier : OldMapping.Modifiers)
+				{
+					if (IsValid(Modifier) && !Modifier->IsA<UInputModifierNegate>() && !Modifier->IsA<UInputModifierSwizzleAxis>())
+					{
+						NewMapping.Modifiers.Add(Modifier);
+					}
+				}
+			}
+
+			for (const FSavedInputModifier& SavedModifier : SavedMapping.Modifiers)
+			{
+				if (UInputModifier* const Modifier = SavedModifier.GetModifier())
+				{
+					NewMapping.Modifiers.Add(Modifier);
+				}
+			}
+		}
+
+		ModifiedContexts.AddUnique(InputContext);
+	}
+
+	if (ModifiedContexts.Num() > 0)
+	{
+		RebuildMappingsForContexts(ModifiedContexts);
+
+		// The bindings were just loaded, so there's nothing new to save
+		BindingsSaveCountdown = -1.0f;
+	}
+}
+
+bool UUINavPCComponent::IntroducesKeyConflicts(const TArray<FEnhancedActionKeyMapping>& OldMappings, const TArray<FEnhancedActionKeyMapping>& NewMappings)
+{
+	TSet<TPair<FKey, const UInputAction*>> OldKeyActions;
+	OldKeyActions.Reserve(OldMappings.Num());
+	for (const FEnhancedActionKeyMapping& OldMapping : OldMappings)
+	{
+		OldKeyActions.Add(TPair<FKey, const UInputAction*>(OldMapping.Key, OldMapping.Action));
+	}
+
+	struct FKeyActions
+	{
+		const UInputAction* FirstAction = nullptr;
+		bool bHasOtherActions = false;
+		bool bHasNewAction = false;
+	};
+
+	TMap<FKey, FKeyActions> KeysActions;
+	KeysActions.Reserve(NewMappings.Num());
+	for (const FEnhancedActionKeyMapping& Mapping : NewMappings)
+	{
+		FKeyActions* KeyActions = KeysActions.Find(Mapping.Key);
+		if (KeyActions == nullptr)
+		{
+			KeyActions = &KeysActions.Add(Mapping.Key);
+			KeyActions->FirstAction = Mapping.Action;
+		}
+		else if (KeyActions->FirstAction != Mapping.Action)
+		{
+			KeyActions->bHasOtherActions = true;
+		}
+
+		if (!KeyActions->bHasNewAction && !OldKeyActions.Contains(TPair<FKey, const UInputAction*>(Mapping.Key, Mapping.Action)))
+		{
+			KeyActions->bHasNewAction = true;
+		}
+
+		// Conflicts that were already in the context aren't the transaction's fault, so the key must also have an action it didn't have before
+		if (KeyActions->bHasOtherActions && KeyActions->bHasNewAction)
+		{
+			return true;
 		}
 	}
+
+	return false;
 }
 
-void UUINavPCComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+void UUINavPCComponent::OnControllerConnectionChanged(EInputDeviceConnectionState NewConnectionState, FPlatformUserId UserId, FInputDeviceId UserIndex)
 {
-	if (PC != nullptr && PC->IsLocalPlayerController())
+	IUINavPCReceiver::Execute_OnControllerConnectionChanged(GetOwner(), NewConnectionState == EInputDeviceConnectionState::Connected, static_cast<int32>(UserId), static_cast<int32>(UserIndex.GetId()));
+}
+
+void UUINavPCComponent::CacheGameInputContexts()
+{
+	if (bInputContextsCached || InputContextsLoadHandle.IsValid())
 	{
-		FSlateApplication::Get().UnregisterInputPreProcessor(SharedInputProcessor);
+		return;
 	}
-	
-	IPlatformInputDeviceMapper::Get().GetOnInputDeviceConnectionChange().RemoveAll(this);
 
-	Super::EndPlay(EndPlayReason);
+	InputContextPaths.Reset();
+	GatherInputContextPaths(InputContextPaths);
+
+	if (InputContextPaths.Num() > 0 && GetDefault<UUINavSettings>()->bLoadInputContextsAsync)
+	{
+		InputContextsLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+			InputContextPaths,
+			FStreamableDelegate::CreateUObject(this, &UUINavPCComponent::OnInputContextsLoaded));
+
+		if (InputContextsLoadHandle.IsValid())
+		{
+			return;
+		}
+	}
+
+	for (const FSoftObjectPath& ContextPath : InputContextPaths)
+	{
+		ContextPath.TryLoad();
+	}
+
+	OnInputContextsLoaded();
 }
 
-void UUINavPCComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UUINavPCComponent::GatherInputContextPaths(TArray<FSoftObjectPath>& OutContextPaths)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	const UUINavSettings* const UINavSettings = GetDefault<UUINavSettings>();
 
-	switch (CountdownPhase)
+	if (UINavSettings->InputContexts.Num() > 0)
 	{
-		case ECountdownPhase::First:
-			TimerCounter += DeltaTime;
-			if (TimerCounter >= InputHeldWaitTime)
+		for (const TSoftObjectPtr<UInputMappingContext>& InputContext : UINavSettings->InputContexts)
+		{
+			if (!InputContext.IsNull())
 			{
-				NavigateInDirection(CallbackDirection);
-				TimerCounter -= InputHeldWaitTime;
-				CountdownPhase = ECountdownPhase::Looping;
+				OutContextPaths.AddUnique(InputContext.ToSoftObjectPath());
 			}
-			break;
-		case ECountdownPhase::Looping:
-			TimerCounter += DeltaTime;
-			if (TimerCounter >= NavigationChainFrequency)
+		}
+	}
+	else
+	{
+		FARFilter Filter;
+		Filter.ClassPaths.Add(UInputMappingContext::StaticClass()->GetClassPathName());
+		Filter.bRecursiveClasses = true;
+		Filter.bRecursivePaths = true;
+		for (const FDirectoryPath& ContextDirectory : UINavSettings->InputContextPaths)
+		{
+			if (!ContextDirectory.Path.IsEmpty())
 			{
-				NavigateInDirection(CallbackDirection);
-				TimerCounter -= NavigationChainFrequency;
+				Filter.PackagePaths.Add(FName(*ContextDirectory.Path));
 			}
-			break;
+		}
+
+		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+		TArray<FAssetData> AssetsData;
+		AssetRegistryModule.Get().GetAssets(Filter, AssetsData);
+		for (const FAssetData& AssetData : AssetsData)
+		{
+			if (UINavSettings->InputContextTags.Num() > 0 &&
+				!UINavSettings->InputContextTags.ContainsByPredicate([&AssetData](const FName& Tag) { return AssetData.TagsAndValues.Contains(Tag); }))
+			{
+				continue;
+			}
+
+			OutContextPaths.AddUnique(AssetData.ToSoftObjectPath());
+		}
 	}
 
-	if (!bReceivedAnalogInput)
+	// The UINav input context must always be available for rebinding and resetting the menu inputs
+	if (!UINavSettings->EnhancedInputContext.IsNull())
 	{
-		ThumbstickDelta = FVector2D::ZeroVector;
+		OutContextPaths.AddUnique(UINavSettings->EnhancedInputContext.ToSoftObjectPath());
 	}
-	else
+}
+
+void UUINavPCComponent::OnInputContextsLoaded()
+{
+	InputContextsLoadHandle.Reset();
+
+	for (const FSoftObjectPath& ContextPath : InputContextPaths)
 	{
-		bReceivedAnalogInput = false;
+		const UInputMappingContext* const InputContext = Cast<UInputMappingContext>(ContextPath.ResolveObject());
+		if (!IsValid(InputContext))
+		{
+			continue;
+		}
+
+		CachedInputContexts.Add(InputContext);
 	}
 
-	if (bIgnoreFocusByNavigation)
+	InputContextPaths.Empty();
+	bInputContextsCached = true;
+
+	TryResetDefaultInputs();
+	LoadInputBindings();
+
+	InputContextsCachedDelegate.Broadcast();
+	InputContextsCachedDelegate.Clear();
+}
+
+void UUINavPCComponent::TryResetDefaultInputs()
+{
+	UUINavDefaultInputSettings* DefaultInputSettings = GetMutableDefault<UUINavDefaultInputSettings>();
+	if (DefaultInputSettings->DefaultEnhancedInputMappings.Num() == 0)
 	{
-		bIgnoreFocusByNavigation = false;
+		for (const UInputMappingContext* const InputContext : CachedInputContexts)
+		{
+			DefaultInputSettings->DefaultEnhancedInputMappings.Add(TSoftObjectPtr<UInputMappingContext>(FAssetData(InputContext).ToSoftObjectPath()), InputContext->GetMappings());
+		}
+#if WITH_EDITOR
+		// Only the editor writes the defaults to the config. At runtime they're kept in memory, and rebinds go to the bindings save
+		if (GIsEditor)
+		{
+			DefaultInputSettings->SaveConfig();
+		}
+#endif
 	}
 
-	if (UsingThumbstickAsMouse() != EThumbstickAsMouse::None != bUsingThumbstickAsMouse)
+	// Load the defaults once and keep them in memory, shared by every player
+	for (const TPair<TSoftObjectPtr<UInputMappingContext>, FInputMappingArray>& Entry : DefaultInputSettings->DefaultEnhancedInputMappings)
 	{
-		bUsingThumbstickAsMouse = !bUsingThumbstickAsMouse;
-		RefreshNavigationKeys();
+		const UInputMappingContext* const InputContext = Entry.Key.Get();
+		if (!IsValid(InputContext) || DefaultInputSettings->DefaultMappingsSnapshots.Contains(InputContext))
+		{
+			continue;
+		}
+
+		FMappingContextSnapshot& DefaultMappings = DefaultInputSettings->DefaultMappingsSnapshots.Add(InputContext);
+		DefaultMappings.Mappings.Reserve(Entry.Value.DefaultInputMappings.Num());
+		for (const FUINavEnhancedActionKeyMapping& DefaultInputMapping : Entry.Value.DefaultInputMappings)
+		{
+			FEnhancedActionKeyMapping& Mapping = DefaultMappings.Mappings.Emplace_GetRef(DefaultInputMapping.Action.LoadSynchronous(), DefaultInputMapping.Key);
+
+			for (const TSoftObjectPtr<UInputModifier>& Modifier : DefaultInputMapping.Modifiers)
+			{
+				Mapping.Modifiers.Add(Modifier.LoadSynchronous());
+			}
+
+			for (const TSoftObjectPtr<UInputTrigger>& Trigger : DefaultInputMapping.Triggers)
+			{
+				Mapping.Triggers.Add(Trigger.LoadSynchronous());
+			}
+		}
 	}
 }
 
-void UUINavPCComponent::RequestRebuildMappings()
+void UUINavPCComponent::ResetBindingsToDefault(const UInputMappingContext* InputContext, const UInputAction* Action, TArray<const UInputAction*>& OutResetActions)
 {
-	UEnhancedInputLibrary::ForEachSubsystem([](IEnhancedInputSubsystemInterface* Subsystem)
+	const UUINavDefaultInputSettings* const DefaultInputSettings = GetDefault<UUINavDefaultInputSettings>();
+
+	// The original contexts are never modified, so only this player's copies can need resetting
+	TArray<UInputMappingContext*> ModifiedContexts;
+	for (const TPair<const UInputMappingContext*, UInputMappingContext*>& PlayerInputContext : PlayerInputContexts)
 	{
-		if (Subsystem)
+		if (InputContext != nullptr && InputContext != PlayerInputContext.Key && InputContext != PlayerInputContext.Value)
 		{
-			Subsystem->RequestRebuildControlMappings();
+			continue;
 		}
-	});
-}
 
-void UUINavPCComponent::OnControllerConnectionChanged(EInputDeviceConnectionState NewConnectionState, FPlatformUserId UserId, FInputDeviceId UserIndex)
-{
-	IUINavPCReceiver::Execute_OnControllerConnectionChanged(GetOwner(), NewConnectionState == EInputDeviceConnectionState::Connected, static_cast<int32>(UserId), static_cast<int32>(UserIndex.GetId()));
-}
+		const FMappingContextSnapshot* const DefaultMappings = DefaultInputSettings->GetDefaultMappings(PlayerInputContext.Key);
+		if (DefaultMappings == nullptr || !IsValid(PlayerInputContext.Value))
+		{
+			continue;
+		}
 
-void UUINavPCComponent::CacheGameInputContexts()
-{
-	if (CachedInputContexts.Num() == 0)
-	{
-		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-		TArray<FAssetData> AssetsData;
-		AssetRegistryModule.Get().GetAssetsByClass(UInputMappingContext::StaticClass()->GetClassPathName(), AssetsData);
-		for (const FAssetData& AssetData : AssetsData)
+		TArray<const UInputAction*> Actions;
+		if (Action != nullptr)
 		{
-			const UInputMappingContext* const InputContext = Cast<UInputMappingContext>(AssetData.GetAsset());
-			if (!IsValid(InputContext))
+			Actions.Add(Action);
+		}
+		else
+		{
+			DefaultMappings->GetActions(PlayerInputContext.Value, Actions);
+		}
+
+		for (const UInputAction* const ContextAction : Actions)
+		{
+			if (!DefaultMappings->ActionDiffers(PlayerInputContext.Value, ContextAction))
 			{
 				continue;
 			}
 
-			CachedInputContexts.Add(InputContext);
+			if (!ModifiedContexts.Contains(PlayerInputContext.Value))
+			{
+				NotifyMappingContextModified(PlayerInputContext.Value);
+				ModifiedContexts.Add(PlayerInputContext.Value);
+			}
+
+			DefaultMappings->RestoreAction(PlayerInputContext.Value, ContextAction);
+			ensureMsgf(!DefaultMappings->ActionDiffers(PlayerInputContext.Value, ContextAction),
+				TEXT("Action %s still differs from its default mappings after being reset"), *GetNameSafe(ContextAction));
+			OutResetActions.AddUnique(ContextAction);
 		}
 	}
+
+	if (ModifiedContexts.Num() == 0)
+	{
+		return;
+	}
+
+	// A binding transaction rebuilds the modified contexts when it's committed
+	if (!IsInBindingTransaction())
+	{
+		RebuildMappingsForContexts(ModifiedContexts);
+	}
+
+	RefreshNavigationKeys();
 }
 
-void UUINavPCComponent::TryResetDefaultInputs()
+void UUINavPCComponent::ResetAllBindingsToDefault()
 {
-	UUINavDefaultInputSettings* DefaultInputSettings = GetMutableDefault<UUINavDefaultInputSettings>();
-	if (DefaultInputSettings->DefaultEnhancedInputMappings.Num() == 0)
+	TArray<const UInputAction*> ResetActions;
+	ResetBindingsToDefault(nullptr, nullptr, ResetActions);
+}
+
+void UUINavPCComponent::ResetActionBindingsToDefault(UInputMappingContext* InputContext, const UInputAction* Action)
+{
+	if (!IsValid(Action))
 	{
-		for (const UInputMappingContext* const InputContext : CachedInputContexts)
-		{
-			DefaultInputSettings->DefaultEnhancedInputMappings.Add(TSoftObjectPtr<UInputMappingContext>(FAssetData(InputContext).ToSoftObjectPath()), InputContext->GetMappings());
-		}
-		DefaultInputSettings->SaveConfig();
+		return;
 	}
+
+	TArray<const UInputAction*> ResetActions;
+	ResetBindingsToDefault(InputContext, Action, ResetActions);
 }
 
 void UUINavPCComponent::ProcessRebind(const FKey Key)
@@ -268,10 +1322,21 @@ void UUINavPCComponent::SetActiveWidget(UUINavWidget * NewActiveWidget)
 		}
 	}
 
+	const EThumbstickAsMouse PreviousThumbstickAsMouse = UsingThumbstickAsMouse();
+
 	IUINavPCReceiver::Execute_OnActiveWidgetChanged(GetOwner(), ActiveWidget, NewActiveWidget);
+	ActiveWidgetChangedEvent.Broadcast(ActiveWidget, NewActiveWidget);
 	ActiveWidget = NewActiveWidget;
 	ActiveSubWidget = nullptr;
-	RefreshNavigationKeys();
+
+	// The navigation config only depends on the active widget through its thumbstick as mouse setting,
+	// so it's only rebuilt if that changed or if it was replaced by another player's config
+	if (UsingThumbstickAsMouse() != PreviousThumbstickAsMouse ||
+		!NavigationConfig.IsValid() ||
+		&FSlateApplication::Get().GetNavigationConfig().Get() != NavigationConfig.Get())
+	{
+		RefreshNavigationKeys();
+	}
 }
 
 void UUINavPCComponent::NotifyNavigatedTo(UUINavWidget* NavigatedWidget)
@@ -302,9 +1367,12 @@ void UUINavPCComponent::NotifyNavigatedTo(UUINavWidget* NavigatedWidget)
 
 	ActiveSubWidget = CommonParent != NavigatedWidget ? NavigatedWidget : nullptr;
 
+	RecordTelemetry(ENavigationTelemetryEvent::Navigated, NavigatedWidget->GetClass()->GetFName());
+
+	static const TArray<int> EmptyPath;
 	uint8 Depth = 0;
-	const TArray<int>& OldPath = OldActiveWidget != nullptr ? OldActiveWidget->GetUINavWidgetPath() : TArray<int>();
-	const TArray<int>& NewPath = NavigatedWidget != nullptr ? NavigatedWidget->GetUINavWidgetPath() : TArray<int>();
+	const TArray<int>& OldPath = OldActiveWidget != nullptr ? OldActiveWidget->GetUINavWidgetPath() : EmptyPath;
+	const TArray<int>& NewPath = NavigatedWidget != nullptr ? NavigatedWidget->GetUINavWidgetPath() : EmptyPath;
 
 	if (OldPath.Num() == Depth && OldActiveWidget != nullptr) OldActiveWidget->LoseNavigation(NavigatedWidget);
 	if (NewPath.Num() == Depth && NavigatedWidget != nullptr) NavigatedWidget->GainNavigation(OldActiveWidget);
@@ -349,17 +1417,196 @@ UUINavWidget* UUINavPCComponent::GoToWidget(TSubclassOf<UUINavWidget> NewWidgetC
 		return nullptr;
 	}
 
-	UUINavWidget* NewWidget = CreateWidget<UUINavWidget>(PC, NewWidgetClass);
+	UUINavWidget* NewWidget = CreateUINavWidget(NewWidgetClass);
 	return GoToBuiltWidget(NewWidget, bRemoveParent, bDestroyParent, ZOrder);
 }
 
+void UUINavPCComponent::PrewarmWidgets(const TArray<TSubclassOf<UUINavWidget>>& WidgetClasses)
+{
+	for (const TSubclassOf<UUINavWidget>& WidgetClass : WidgetClasses)
+	{
+		if (WidgetClass == nullptr || PrewarmedWidgets.Contains(WidgetClass))
+		{
+			continue;
+		}
+
+		UUINavWidget* const NewWidget = CreateWidget<UUINavWidget>(PC, WidgetClass);
+		if (IsValid(NewWidget))
+		{
+			NewWidget->Prewarm();
+			PrewarmedWidgets.Add(WidgetClass, NewWidget);
+		}
+	}
+}
+
+void UUINavPCComponent::PrewarmConfiguredWidgets()
+{
+	const UUINavSettings* const UINavSettings = GetDefault<UUINavSettings>();
+	if (PrewarmLoadHandle.IsValid())
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> PrewarmPaths;
+	for (const TSoftClassPtr<UUINavWidget>& WidgetClass : UINavSettings->PrewarmWidgetClasses)
+	{
+		if (!WidgetClass.IsNull())
+		{
+			PrewarmPaths.Add(WidgetClass.ToSoftObjectPath());
+		}
+	}
+
+	if (UINavSettings->bPrewarmKeyIcons)
+	{
+		for (const UDataTable* const IconData : { GamepadKeyIconData, KeyboardMouseKeyIconData })
+		{
+			if (IconData == nullptr)
+			{
+				continue;
+			}
+
+			for (const TPair<FName, uint8*>& Row : IconData->GetRowMap())
+			{
+				const FInputIconMapping* const IconMapping = reinterpret_cast<const FInputIconMapping*>(Row.Value);
+				if (!IconMapping->InputIcon.IsNull())
+				{
+					PrewarmPaths.Add(IconMapping->InputIcon.ToSoftObjectPath());
+				}
+			}
+		}
+	}
+
+	if (PrewarmPaths.Num() == 0)
+	{
+		return;
+	}
+
+	PrewarmLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		PrewarmPaths,
+		FStreamableDelegate::CreateWeakLambda(this, [this]()
+		{
+			TArray<TSubclassOf<UUINavWidget>> WidgetClasses;
+			for (const TSoftClassPtr<UUINavWidget>& WidgetClass : GetDefault<UUINavSettings>()->PrewarmWidgetClasses)
+			{
+				WidgetClasses.Add(WidgetClass.Get());
+			}
+
+			// Only the key icons may have been loaded
+			if (WidgetClasses.Num() > 0)
+			{
+				PrewarmWidgets(WidgetClasses);
+			}
+		}));
+}
+
+UUINavWidget* UUINavPCComponent::CreateUINavWidget(TSubclassOf<UUINavWidget> WidgetClass)
+{
+	UUINavWidget* PrewarmedWidget = nullptr;
+	if (PrewarmedWidgets.RemoveAndCopyValue(WidgetClass, PrewarmedWidget) && IsValid(PrewarmedWidget))
+	{
+		return PrewarmedWidget;
+	}
+
+	return CreateWidget<UUINavWidget>(PC, WidgetClass);
+}
+
+void UUINavPCComponent::PushNavigationStack(UUINavWidget* Widget)
+{
+	const UUINavSettings* const UINavSettings = GetDefault<UUINavSettings>();
+	if (!IsValid(Widget) || UINavSettings->MaxNavigationStackDepth <= 0)
+	{
+		return;
+	}
+
+	// A widget is only in the stack once, at the position it was last left from
+	NavigationStack.RemoveAll([Widget](const FNavigationStackEntry& Entry) { return Entry.Widget == Widget; });
+
+	FNavigationStackEntry& NewEntry = NavigationStack.AddDefaulted_GetRef();
+	NewEntry.Widget = Widget;
+	NewEntry.State = Widget->CaptureWidgetState();
+
+	if (NavigationStack.Num() > UINavSettings->MaxNavigationStackDepth)
+	{
+		NavigationStack.RemoveAt(0, NavigationStack.Num() - UINavSettings->MaxNavigationStackDepth);
+	}
+
+	// Release the Slate widgets of the oldest removed widgets past the limit. Widgets still in the viewport are always kept
+	int32 NumRetained = 0;
+	for (int32 i = NavigationStack.Num() - 1; i >= 0; --i)
+	{
+		FNavigationStackEntry& Entry = NavigationStack[i];
+		if (!Entry.bRetained || !IsValid(Entry.Widget) || Entry.Widget->IsInViewport() || Entry.Widget->WidgetComp != nullptr)
+		{
+			continue;
+		}
+
+		if (NumRetained < UINavSettings->MaxRetainedStackWidgets)
+		{
+			NumRetained++;
+			continue;
+		}
+
+		Entry.Widget->ReleaseSlateResources(true);
+		Entry.bRetained = false;
+	}
+}
+
+bool UUINavPCComponent::PopNavigationStack(const UUINavWidget* Widget, FNavigationStackEntry& OutEntry)
+{
+	const int32 EntryIndex = NavigationStack.FindLastByPredicate([Widget](const FNavigationStackEntry& Entry) { return Entry.Widget == Widget; });
+	if (EntryIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutEntry = NavigationStack[EntryIndex];
+	NavigationStack.RemoveAt(EntryIndex, NavigationStack.Num() - EntryIndex);
+	return true;
+}
+
+void UUINavPCComponent::ClearNavigationStack()
+{
+	NavigationStack.Reset();
+}
+
+void UUINavPCComponent::QueueWidgetTeardown(UUINavWidget* Widget)
+{
+	TeardownQueue.AddUnique(Widget);
+}
+
+bool UUINavPCComponent::CancelWidgetTeardown(UUINavWidget* Widget)
+{
+	return TeardownQueue.Remove(Widget) > 0;
+}
+
+void UUINavPCComponent::ProcessTeardownQueue()
+{
+	const double BudgetEndTime = FPlatformTime::Seconds() + GetDefault<UUINavSettings>()->WidgetTeardownBudget / 1000.0;
+
+	// At least one widget is removed each frame, so that the queue is always drained
+	int32 NumRemoved = 0;
+	do
+	{
+		UUINavWidget* const Widget = TeardownQueue[NumRemoved++];
+		if (IsValid(Widget))
+		{
+			Widget->FinishTeardown();
+		}
+	}
+	while (NumRemoved < TeardownQueue.Num() && FPlatformTime::Seconds() < BudgetEndTime);
+
+	TeardownQueue.RemoveAt(0, NumRemoved);
+}
+
 UUINavWidget* UUINavPCComponent::GoToBuiltWidget(UUINavWidget* NewWidget, const bool bRemoveParent, const bool bDestroyParent, const int ZOrder)
 {
 	if (NewWidget == nullptr) return nullptr;
 
 	if (ActiveWidget == nullptr)
 	{
+		RecordTelemetry(ENavigationTelemetryEvent::WidgetOpened, NewWidget->GetClass()->GetFName());
 		NewWidget->AddToViewport();
+		NewWidget->FinishPrewarm();
 		NewWidget->SetFocus();
 		return NewWidget;
 	}
@@ -375,12 +1622,13 @@ EThumbstickAsMouse UUINavPCComponent::UsingThumbstickAsMouse() const
 
 void UUINavPCComponent::RefreshNavigationKeys()
 {
-	FSlateApplication::Get().SetNavigationConfig(
-		MakeShared<FUINavigationConfig>(
-			bAllowSelectInput,
-			bAllowReturnInput,
-			bUseAnalogDirectionalInput && UsingThumbstickAsMouse() != EThumbstickAsMouse::LeftThumbstick,
-			UsingThumbstickAsMouse() != EThumbstickAsMouse::None));
+	NavigationConfig = MakeShared<FUINavigationConfig>(
+		bAllowSelectInput,
+		bAllowReturnInput,
+		bUseAnalogDirectionalInput && UsingThumbstickAsMouse() != EThumbstickAsMouse::LeftThumbstick,
+		UsingThumbstickAsMouse() != EThumbstickAsMouse::None,
+		GetPlayerInputContext(GetDefault<UUINavSettings>()->EnhancedInputContext.LoadSynchronous()));
+	FSlateApplication::Get().SetNavigationConfig(NavigationConfig.ToSharedRef());
 }
 
 void UUINavPCComponent::SetAllowAllMenuInput(const bool bAllowInput)
@@ -682,7 +1930,7 @@ FKey UUINavPCComponent::GetEnhancedInputKey(const UInputAction* Action, const EI
 {
 	if (UUINavBlueprintFunctionLibrary::IsUINavInputAction(Action))
 	{
-		const UInputMappingContext* const UINavInputContext = GetDefault<UUINavSettings>()->EnhancedInputContext.LoadSynchronous();
+		const UInputMappingContext* const UINavInputContext = GetPlayerInputContext(GetDefault<UUINavSettings>()->EnhancedInputContext.LoadSynchronous());
 		for (const FEnhancedActionKeyMapping& Mapping : UINavInputContext->GetMappings())
 		{
 			if (Mapping.Action == Action && UUINavBlueprintFunctionLibrary::RespectsRestriction(Mapping.Key, InputRestriction))
@@ -719,7 +1967,7 @@ FKey UUINavPCComponent::GetEnhancedInputKey(const UInputAction* Action, const EI
 
 	for (const UInputMappingContext* const InputContext : CachedInputContexts)
 	{
-		for (const FEnhancedActionKeyMapping& Mapping : InputContext->GetMappings())
+		for (const FEnhancedActionKeyMapping& Mapping : GetConstPlayerInputContext(InputContext)->GetMappings())
 		{
 			if (Mapping.Action == Action && UUINavBlueprintFunctionLibrary::RespectsRestriction(Mapping.Key, InputRestriction))
 			{
@@ -981,6 +2229,7 @@ void UUINavPCComponent::NotifyInputTypeChange(const EInputType NewInputType, con
 
 	const EInputType OldInputType = CurrentInputType;
 	CurrentInputType = NewInputType;
+	RecordTelemetry(ENavigationTelemetryEvent::InputTypeChanged, NAME_None, INDEX_NONE, static_cast<uint8>(OldInputType), static_cast<uint8>(NewInputType));
 	if (ActiveWidget != nullptr)
 	{
 		if (bAttemptUnforceNavigation)
@@ -989,7 +2238,11 @@ void UUINavPCComponent::NotifyInputTypeChange(const EInputType NewInputType, con
 		}
 		ActiveWidget->PropagateOnInputChanged(OldInputType, CurrentInputType);
 	}
-	InputTypeChangedDelegate.Broadcast(CurrentInputType);
+	InputTypeChangedEvent.Broadcast(OldInputType, CurrentInputType);
+	if (InputTypeChangedDelegate.IsBound())
+	{
+		InputTypeChangedDelegate.Broadcast(CurrentInputType);
+	}
 }
 
 UEnhancedInputComponent* UUINavPCComponent::GetEnhancedInputComponent() const
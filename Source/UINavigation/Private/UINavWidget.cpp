@@ -9,8 +9,10 @@
 #include "UINavPromptWidget.h"
 #include "UINavSettings.h"
 #include "UINavWidgetComponent.h"
+#include "UINavLazyWidget.h"
 #include "UINavBlueprintFunctionLibrary.h"
 #include "UINavMacros.h"
+#include "Data/BlueprintEventOverrides.h"
 #include "ComponentActions/UINavComponentAction.h"
 #include "Blueprint/UserWidget.h"
 #include "Blueprint/WidgetTree.h"
@@ -25,6 +27,7 @@
 #include "Components/CanvasPanelSlot.h"
 #include "Components/ActorComponent.h"
 #include "Components/ListView.h"
+#include "Components/PanelWidget.h"
 #include "Engine/GameViewportClient.h"
 #include "Engine/ViewportSplitScreen.h"
 #include "Curves/CurveFloat.h"
@@ -38,16 +41,146 @@ UUINavWidget::UUINavWidget(const FObjectInitializer& ObjectInitializer)
 	SetIsFocusable(true);
 }
 
+// The navigation events called on every navigation, in the order of their names below
+enum class EUINavWidgetEvent : uint8
+{
+	OnNavigate,
+	OnSelect,
+	OnStartSelect,
+	OnStopSelect,
+	OnNext,
+	OnPrevious,
+	OnInputChanged,
+	OnGainedNavigation,
+	OnLostNavigation,
+};
+
+enum class EUINavComponentEvent : uint8
+{
+	OnNavigatedTo,
+	OnNavigatedFrom,
+};
+
+static bool IsEventOverridden(const UUINavWidget* Widget, const EUINavWidgetEvent Event)
+{
+	static FBlueprintEventOverrides WidgetEventOverrides({
+		GET_FUNCTION_NAME_CHECKED(UUINavWidget, OnNavigate),
+		GET_FUNCTION_NAME_CHECKED(UUINavWidget, OnSelect),
+		GET_FUNCTION_NAME_CHECKED(UUINavWidget, OnStartSelect),
+		GET_FUNCTION_NAME_CHECKED(UUINavWidget, OnStopSelect),
+		GET_FUNCTION_NAME_CHECKED(UUINavWidget, OnNext),
+		GET_FUNCTION_NAME_CHECKED(UUINavWidget, OnPrevious),
+		GET_FUNCTION_NAME_CHECKED(UUINavWidget, OnInputChanged),
+		GET_FUNCTION_NAME_CHECKED(UUINavWidget, OnGainedNavigation),
+		GET_FUNCTION_NAME_CHECKED(UUINavWidget, OnLostNavigation),
+	});
+	return WidgetEventOverrides.IsOverridden(Widget, static_cast<int32>(Event));
+}
+
+static bool IsEventOverridden(const UUINavComponent* Component, const EUINavComponentEvent Event)
+{
+	static FBlueprintEventOverrides ComponentEventOverrides({
+		GET_FUNCTION_NAME_CHECKED(UUINavComponent, OnNavigatedTo),
+		GET_FUNCTION_NAME_CHECKED(UUINavComponent, OnNavigatedFrom),
+	});
+	return ComponentEventOverrides.IsOverridden(Component, static_cast<int32>(Event));
+}
+
+// Calls the Blueprint event if a Blueprint overrides it, or the native implementation directly otherwise
+template<typename ObjectType, typename EventType, typename... ParamTypes, typename... ArgTypes>
+static void CallNativeEvent(ObjectType* Object, const EventType Event, void (ObjectType::*BlueprintEvent)(ParamTypes...), void (ObjectType::*NativeEvent)(ParamTypes...), ArgTypes&&... Args)
+{
+	if (IsEventOverridden(Object, Event))
+	{
+		(Object->*BlueprintEvent)(Forward<ArgTypes>(Args)...);
+	}
+	else
+	{
+		(Object->*NativeEvent)(Forward<ArgTypes>(Args)...);
+	}
+}
+
+static void GatherStateWidgets(UUINavWidget* Widget, FUINavStateWidgets& OutStateWidgets)
+{
+	OutStateWidgets.Widgets.Add(Widget);
+	if (Widget->WidgetTree == nullptr)
+	{
+		return;
+	}
+
+	TArray<UWidget*> TreeWidgets;
+	Widget->WidgetTree->GetAllWidgets(TreeWidgets);
+	for (UWidget* TreeWidget : TreeWidgets)
+	{
+		if (UUINavComponent* Component = Cast<UUINavComponent>(TreeWidget))
+		{
+			OutStateWidgets.Components.Add(Component);
+			if (UUINavHorizontalComponent* HorizontalComponent = Cast<UUINavHorizontalComponent>(Component))
+			{
+				OutStateWidgets.HorizontalComponents.Add(HorizontalComponent);
+			}
+		}
+		else if (UScrollBox* ScrollBox = Cast<UScrollBox>(TreeWidget))
+		{
+			OutStateWidgets.ScrollBoxes.Add(ScrollBox);
+		}
+		else if (UUINavLazyWidget* LazyWidget = Cast<UUINavLazyWidget>(TreeWidget))
+		{
+			OutStateWidgets.LazyWidgets.Add(LazyWidget);
+		}
+		else if (UUINavWidget* ChildUINavWidget = Cast<UUINavWidget>(TreeWidget))
+		{
+			GatherStateWidgets(ChildUINavWidget, OutStateWidgets);
+		}
+	}
+}
+
+// Builds the lazy widgets that were built when the state was captured, so that the state's indices point to the same widgets
+static void BuildStateLazyWidgets(UUINavWidget* Widget, const FUINavWidgetState& State)
+{
+	// Copied, as building a lazy widget discards the widget's cached state widgets
+	TArray<UUINavLazyWidget*> LazyWidgets = Widget->GetStateWidgets().LazyWidgets;
+	for (int32 i = 0; i < LazyWidgets.Num() && i < State.BuiltLazyWidgets.Num(); ++i)
+	{
+		UUINavLazyWidget* const LazyWidget = LazyWidgets[i];
+		if (!State.BuiltLazyWidgets[i] || LazyWidget->IsBuilt())
+		{
+			continue;
+		}
+
+		UUINavWidget* const BuiltWidget = LazyWidget->Build();
+		if (BuiltWidget == nullptr)
+		{
+			continue;
+		}
+
+		// The built widget is the placeholder's content, so its own lazy widgets come right after the placeholder in tree order
+		FUINavStateWidgets BuiltStateWidgets;
+		GatherStateWidgets(BuiltWidget, BuiltStateWidgets);
+		LazyWidgets.Insert(BuiltStateWidgets.LazyWidgets, i + 1);
+	}
+}
+
 void UUINavWidget::NativeConstruct()
 {
+	// Reopened after being removed, but before its queued teardown ran
+	CancelTeardown(false);
 	bBeingRemoved = false;
 
 	bForcingNavigation = GetDefault<UUINavSettings>()->bForceNavigation;
 
-	const UWorld* const World = GetWorld();
 	OuterUINavWidget = GetOuterObject<UUINavWidget>(this);
 	if (OuterUINavWidget != nullptr)
 	{
+		// Components constructed before this widget registered with it, as it didn't know its outer widget yet
+		if (ComponentRegistry.Num() > 0)
+		{
+			UUINavWidget* const MostOuterUINavWidget = OuterUINavWidget->GetMostOuterUINavWidget();
+			MostOuterUINavWidget->ComponentRegistry.Append(ComponentRegistry, MostOuterUINavWidget);
+		}
+
+		OuterUINavWidget->RegisterChildUINavWidget(this);
+
 		if (!IsValid(OuterUINavWidget->GetFirstComponent()))
 		{
 			OuterUINavWidget->SetFirstComponent(FirstComponent);
@@ -61,6 +194,25 @@ void UUINavWidget::NativeConstruct()
 		Super::NativeConstruct();
 		return;
 	}
+
+	// Only the hierarchy is gathered while prewarming, the rest runs once the widget is added to the screen
+	if (bPrewarming)
+	{
+		ConfigureUINavPC();
+		TraverseHierarchy();
+
+		Super::NativeConstruct();
+		return;
+	}
+
+	SetupOutermostWidget();
+
+	Super::NativeConstruct();
+}
+
+void UUINavWidget::SetupOutermostWidget()
+{
+	const UWorld* const World = GetWorld();
 	if (World != nullptr)
 	{
 		if (const UGameViewportClient* ViewportClient = World->GetGameViewport())
@@ -103,8 +255,45 @@ void UUINavWidget::NativeConstruct()
 
 	PreSetup(!bCompletedSetup);
 	InitialSetup();
+}
 
-	Super::NativeConstruct();
+void UUINavWidget::Prewarm()
+{
+	if (PrewarmedSlateWidget.IsValid() || GetCachedWidget().IsValid())
+	{
+		return;
+	}
+
+	bPrewarming = true;
+	PrewarmedSlateWidget = TakeWidget();
+	bPrewarming = false;
+}
+
+void UUINavWidget::FinishPrewarm()
+{
+	if (!PrewarmedSlateWidget.IsValid())
+	{
+		return;
+	}
+
+	// The viewport took the prewarmed Slate widgets, so they weren't rebuilt and this widget wasn't constructed again
+	const bool bTakenByScreen = PrewarmedSlateWidget.GetSharedReferenceCount() > 1;
+	PrewarmedSlateWidget.Reset();
+	if (bTakenByScreen)
+	{
+		SetupOutermostWidget();
+	}
+}
+
+void UUINavWidget::NativeDestruct()
+{
+	// Nested widgets destructed along with their outer widget stay registered, as they're constructed again with it
+	if (bRegisteredInOuter && IsValid(OuterUINavWidget) && !OuterUINavWidget->IsBeingRemoved())
+	{
+		OuterUINavWidget->UnregisterChildUINavWidget(this);
+	}
+
+	Super::NativeDestruct();
 }
 
 void UUINavWidget::InitialSetup(const bool bRebuilding)
@@ -120,14 +309,29 @@ void UUINavWidget::InitialSetup(const bool bRebuilding)
 		//If widget was already setup, apply only certain steps
 		if (bCompletedSetup)
 		{
-			ReconfigureSetup();
+			if (PendingWidgetState.IsSet())
+			{
+				ResumeSetupFromPendingState();
+			}
+			else
+			{
+				ReconfigureSetup();
+			}
 			return;
 		}
 
 		bSetupStarted = true;
 	}
 
-	TraverseHierarchy();
+	// Nested widgets register themselves when constructed, so the hierarchy is only traversed when not time-slicing
+	if (bTimeSliceSetup)
+	{
+		SetupInitialComponents();
+	}
+	else
+	{
+		TraverseHierarchy();
+	}
 
 	//If this widget doesn't need to create the selector, skip to setup
 	if (!IsSelectorValid())
@@ -137,7 +341,16 @@ void UUINavWidget::InitialSetup(const bool bRebuilding)
 	else
 	{
 		SetupSelector();
-		UINavSetupWaitForTick = 0;
+
+		// A restored state has the selector's position, so there's no need to wait for the geometry to place it
+		if (PendingWidgetState.IsSet() && PendingWidgetState->bHasSelectorPosition)
+		{
+			UINavSetup();
+		}
+		else
+		{
+			UINavSetupWaitForTick = 0;
+		}
 	}
 }
 
@@ -171,6 +384,262 @@ void UUINavWidget::CleanSetup()
 	bSetupStarted = false;
 }
 
+void UUINavWidget::ResumeSetup()
+{
+	bSetupStarted = true;
+
+	for (UUINavWidget* ChildUINavWidget : ChildUINavWidgets)
+	{
+		ChildUINavWidget->ResumeSetup();
+	}
+}
+
+void UUINavWidget::ResumeSetupFromPendingState()
+{
+	// Without the selector's position, the geometry is needed to place it
+	if (IsSelectorValid() && !PendingWidgetState->bHasSelectorPosition)
+	{
+		ReconfigureSetup();
+		return;
+	}
+
+	if (IsSelectorValid())
+	{
+		SetupSelector();
+	}
+	UINavSetupWaitForTick = -1;
+
+	ResumeSetup();
+	UINavSetup();
+}
+
+UUINavComponent* UUINavWidget::ApplyWidgetState(const FUINavWidgetState& State)
+{
+	BuildStateLazyWidgets(this, State);
+
+	// Copied, as applying the values can run Blueprint events that add or remove components
+	const FUINavStateWidgets StateWidgets = GetStateWidgets();
+
+	const int32 NumScrollOffsets = FMath::Min(StateWidgets.ScrollBoxes.Num(), State.ScrollOffsets.Num());
+	for (int32 i = 0; i < NumScrollOffsets; ++i)
+	{
+		StateWidgets.ScrollBoxes[i]->SetScrollOffset(State.ScrollOffsets[i]);
+	}
+
+	const int32 NumHorizontalValues = FMath::Min(StateWidgets.HorizontalComponents.Num(), State.HorizontalComponentValues.Num());
+	for (int32 i = 0; i < NumHorizontalValues; ++i)
+	{
+		UUINavHorizontalComponent* const HorizontalComponent = StateWidgets.HorizontalComponents[i];
+		if (HorizontalComponent->OptionIndex != State.HorizontalComponentValues[i])
+		{
+			HorizontalComponent->SetOptionIndex(State.HorizontalComponentValues[i]);
+		}
+	}
+
+	const int32 NumWidgets = FMath::Min(StateWidgets.Widgets.Num(), State.CurrentComponentIndices.Num());
+	for (int32 i = 0; i < NumWidgets; ++i)
+	{
+		const int32 ComponentIndex = State.CurrentComponentIndices[i];
+		if (StateWidgets.Components.IsValidIndex(ComponentIndex) && IsValid(StateWidgets.Components[ComponentIndex]))
+		{
+			StateWidgets.Widgets[i]->CurrentComponent = StateWidgets.Components[ComponentIndex];
+		}
+	}
+
+	if (State.bHasSelectorPosition && IsSelectorValid())
+	{
+		TheSelector->SetRenderTranslation(State.SelectorPosition);
+	}
+
+	const UUINavWidget* const FocusedWidget = StateWidgets.Widgets.IsValidIndex(State.FocusedWidgetIndex) ? StateWidgets.Widgets[State.FocusedWidgetIndex] : this;
+	return FocusedWidget->CurrentComponent;
+}
+
+const FUINavStateWidgets& UUINavWidget::GetStateWidgets()
+{
+	if (!bStateWidgetsCached)
+	{
+		CachedStateWidgets.Reset();
+		GatherStateWidgets(this, CachedStateWidgets);
+		bStateWidgetsCached = true;
+	}
+
+	return CachedStateWidgets;
+}
+
+FUINavWidgetState UUINavWidget::CaptureWidgetState()
+{
+	const FUINavStateWidgets& StateWidgets = GetStateWidgets();
+
+	FUINavWidgetState State;
+
+	State.CurrentComponentIndices.Reserve(StateWidgets.Widgets.Num());
+	for (const UUINavWidget* Widget : StateWidgets.Widgets)
+	{
+		State.CurrentComponentIndices.Add(StateWidgets.Components.IndexOfByKey(Widget->CurrentComponent));
+	}
+
+	// If navigation isn't in this widget or one of its nested widgets, it's restored to this widget
+	const UUINavWidget* const ActiveSubWidget = IsValid(UINavPC) ? UINavPC->GetActiveSubWidget() : nullptr;
+	State.FocusedWidgetIndex = FMath::Max(StateWidgets.Widgets.IndexOfByKey(ActiveSubWidget), 0);
+
+	State.ScrollOffsets.Reserve(StateWidgets.ScrollBoxes.Num());
+	for (const UScrollBox* ScrollBox : StateWidgets.ScrollBoxes)
+	{
+		State.ScrollOffsets.Add(ScrollBox->GetScrollOffset());
+	}
+
+	State.HorizontalComponentValues.Reserve(StateWidgets.HorizontalComponents.Num());
+	for (const UUINavHorizontalComponent* HorizontalComponent : StateWidgets.HorizontalComponents)
+	{
+		State.HorizontalComponentValues.Add(HorizontalComponent->OptionIndex);
+	}
+
+	State.BuiltLazyWidgets.Reserve(StateWidgets.LazyWidgets.Num());
+	for (const UUINavLazyWidget* LazyWidget : StateWidgets.LazyWidgets)
+	{
+		State.BuiltLazyWidgets.Add(LazyWidget->IsBuilt());
+	}
+
+	// The selector is only placed once the setup completes
+	if (TheSelector != nullptr && bCompletedSetup)
+	{
+		State.SelectorPosition = TheSelector->GetRenderTransform().Translation;
+		State.bHasSelectorPosition = true;
+	}
+
+	return State;
+}
+
+void UUINavWidget::RestoreWidgetState(const FUINavWidgetState& State)
+{
+	PendingWidgetState = State;
+
+	// Widgets that aren't constructed or are still being set up restore the state once their setup finishes
+	if (!GetCachedWidget().IsValid() || !bCompletedSetup || UINavSetupWaitForTick >= 0)
+	{
+		return;
+	}
+
+	// Still on screen, but cleaned up when navigating to another widget
+	if (!bSetupStarted)
+	{
+		ResumeSetupFromPendingState();
+		return;
+	}
+
+	UUINavComponent* const ComponentToFocus = ApplyWidgetState(State);
+	PendingWidgetState.Reset();
+	if (IsValid(ComponentToFocus))
+	{
+		ComponentToFocus->SetFocus();
+	}
+}
+
+bool UUINavWidget::DeferComponentSetup(UUINavComponent* Component)
+{
+	// Nested widgets don't run their own setup, so their components are never deferred
+	if (!bTimeSliceSetup || bCompletedSetup || GetOuterObject<UUINavWidget>(this) != nullptr)
+	{
+		return false;
+	}
+
+	PendingSetupComponents.Add(Component);
+	return true;
+}
+
+void UUINavWidget::SetupInitialComponents()
+{
+	// Components are queued in widget tree order, so the first navigable one is the first component
+	if (!IsValid(FirstComponent))
+	{
+		const int32 FirstIndex = PendingSetupComponents.IndexOfByPredicate([](const UUINavComponent* Component)
+		{
+			return IsValid(Component) && Component->GetCachedWidget().IsValid() && Component->CanBeNavigated();
+		});
+		if (FirstIndex != INDEX_NONE)
+		{
+			SetFirstComponent(PendingSetupComponents[FirstIndex]);
+		}
+	}
+
+	int32 InitialIndex = PendingSetupComponents.IndexOfByKey(GetInitialFocusComponent());
+	if (InitialIndex == INDEX_NONE)
+	{
+		InitialIndex = NumHandledSetupComponents;
+	}
+
+	// The initial component's neighbours are set up first, so that the player can navigate from it right away
+	static constexpr int32 NumInitialNeighbours = 8;
+	const int32 LastIndex = FMath::Min(InitialIndex + NumInitialNeighbours, PendingSetupComponents.Num() - 1);
+	for (int32 i = FMath::Max(InitialIndex - NumInitialNeighbours, NumHandledSetupComponents); i <= LastIndex; ++i)
+	{
+		SetupPendingComponent(i);
+	}
+}
+
+void UUINavWidget::SetupPendingComponents()
+{
+	const double BudgetEndTime = FPlatformTime::Seconds() + GetDefault<UUINavSettings>()->SetupTimeSliceBudget / 1000.0;
+
+	// At least one component is set up each frame, so that the setup always finishes
+	do
+	{
+		SetupPendingComponent(NumHandledSetupComponents++);
+	}
+	while (NumHandledSetupComponents < PendingSetupComponents.Num() && FPlatformTime::Seconds() < BudgetEndTime);
+
+	if (NumHandledSetupComponents >= PendingSetupComponents.Num())
+	{
+		PendingSetupComponents.Reset();
+		NumHandledSetupComponents = 0;
+	}
+}
+
+void UUINavWidget::SetupPendingComponent(const int32 Index)
+{
+	UUINavComponent* const Component = PendingSetupComponents[Index];
+	PendingSetupComponents[Index] = nullptr;
+
+	// Skip components that were already set up, or removed again while they waited
+	if (!IsValid(Component) || !Component->GetCachedWidget().IsValid())
+	{
+		return;
+	}
+
+	if (!IsValid(FirstComponent) && Component->CanBeNavigated())
+	{
+		SetFirstComponent(Component);
+		if (bCompletedSetup)
+		{
+			Component->SetFocus();
+		}
+	}
+
+	if (!IsValid(Component->RegistryOwner))
+	{
+		RegisterComponent(Component);
+	}
+}
+
+void UUINavWidget::PrefetchLazyWidgets()
+{
+	// Building a lazy widget can register others in this same array, so it's iterated by index
+	for (int32 i = 0; i < LazyWidgets.Num(); ++i)
+	{
+		if (IsValid(LazyWidgets[i]))
+		{
+			LazyWidgets[i]->Build();
+		}
+	}
+
+	// Building lazy widgets adds nested widgets, which may have lazy widgets of their own
+	for (int32 i = 0; i < ChildUINavWidgets.Num(); ++i)
+	{
+		ChildUINavWidgets[i]->PrefetchLazyWidgets();
+	}
+}
+
 void UUINavWidget::ConfigureUINavPC()
 {
 	APlayerController* PC = Cast<APlayerController>(GetOwningPlayer());
@@ -197,8 +666,7 @@ void UUINavWidget::TraverseHierarchy()
 		UUINavWidget* ChildUINavWidget = Cast<UUINavWidget>(Widget);
 		if (ChildUINavWidget != nullptr)
 		{
-			ChildUINavWidget->AddParentToPath(ChildUINavWidgets.Num());
-			ChildUINavWidgets.Add(ChildUINavWidget);
+			RegisterChildUINavWidget(ChildUINavWidget);
 		}
 	}
 }
@@ -223,9 +691,20 @@ void UUINavWidget::UINavSetup()
 
 	bCompletedSetup = true;
 
-	if (ReturnedFromWidget != nullptr && IsValid(CurrentComponent))
+	UUINavComponent* ComponentToFocus = ReturnedFromWidget != nullptr ? CurrentComponent : nullptr;
+	if (PendingWidgetState.IsSet())
 	{
-		CurrentComponent->SetFocus();
+		UUINavComponent* const RestoredComponent = ApplyWidgetState(PendingWidgetState.GetValue());
+		PendingWidgetState.Reset();
+		if (IsValid(RestoredComponent))
+		{
+			ComponentToFocus = RestoredComponent;
+		}
+	}
+
+	if (IsValid(ComponentToFocus))
+	{
+		ComponentToFocus->SetFocus();
 		if (!GetDefault<UUINavSettings>()->bForceNavigation && !IsValid(HoveredComponent))
 		{
 			UnforceNavigation(false);
@@ -243,6 +722,11 @@ void UUINavWidget::UINavSetup()
 
 	IgnoreHoverComponent = nullptr;
 
+	if (OuterUINavWidget == nullptr)
+	{
+		UINavPC->OnWidgetOpened().Broadcast(this);
+	}
+
 	OnSetupCompleted();
 }
 
@@ -294,7 +778,7 @@ void UUINavWidget::GainNavigation(UUINavWidget* PreviousActiveWidget)
 	const bool bPreviousWidgetIsChild = PreviousActiveWidget != nullptr ?
                                     UUINavBlueprintFunctionLibrary::ContainsArray<int>(PreviousActiveWidget->GetUINavWidgetPath(), UINavWidgetPath) :
                                     false;
-	OnGainedNavigation(PreviousActiveWidget, bPreviousWidgetIsChild);
+	CallNativeEvent(this, EUINavWidgetEvent::OnGainedNavigation, &UUINavWidget::OnGainedNavigation, &UUINavWidget::OnGainedNavigation_Implementation, PreviousActiveWidget, bPreviousWidgetIsChild);
 }
 
 void UUINavWidget::OnGainedNavigation_Implementation(UUINavWidget* PreviousActiveWidget, const bool bFromChild)
@@ -342,7 +826,7 @@ void UUINavWidget::LoseNavigation(UUINavWidget* NewActiveWidget)
 
 	if (!bNewWidgetIsChild && bHaveSameOuter) CurrentComponent = nullptr;
 
-	OnLostNavigation(NewActiveWidget, bNewWidgetIsChild);
+	CallNativeEvent(this, EUINavWidgetEvent::OnLostNavigation, &UUINavWidget::OnLostNavigation, &UUINavWidget::OnLostNavigation_Implementation, NewActiveWidget, bNewWidgetIsChild);
 }
 
 void UUINavWidget::OnLostNavigation_Implementation(UUINavWidget* NewActiveWidget, const bool bToChild)
@@ -383,7 +867,7 @@ FReply UUINavWidget::NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEven
 {
 	FReply Reply = Super::NativeOnKeyDown(InGeometry, InKeyEvent);
 
-	if (!IsValid(CurrentComponent))
+	if (!IsValid(CurrentComponent) && !bBeingRemoved)
 	{
 		if (FSlateApplication::Get().GetNavigationActionFromKey(InKeyEvent) == EUINavigationAction::Accept)
 		{
@@ -401,7 +885,7 @@ FReply UUINavWidget::NativeOnKeyUp(const FGeometry& InGeometry, const FKeyEvent&
 {
 	FReply Reply = Super::NativeOnKeyUp(InGeometry, InKeyEvent);
 
-	if (!IsValid(CurrentComponent))
+	if (!IsValid(CurrentComponent) && !bBeingRemoved)
 	{
 		if (FSlateApplication::Get().GetNavigationActionFromKey(InKeyEvent) == EUINavigationAction::Accept)
 		{
@@ -426,6 +910,11 @@ void UUINavWidget::NativeTick(const FGeometry & MyGeometry, float DeltaTime)
 {
 	Super::NativeTick(MyGeometry, DeltaTime);
 
+	if (NumHandledSetupComponents < PendingSetupComponents.Num())
+	{
+		SetupPendingComponents();
+	}
+
 	if (IsSelectorValid())
 	{
 		if (UINavSetupWaitForTick >= 0)
@@ -473,6 +962,11 @@ void UUINavWidget::RemoveFromParent()
 	}
 	bReturningToParent = false;
 
+	if (OuterUINavWidget == nullptr && IsValid(UINavPC) && bCompletedSetup)
+	{
+		UINavPC->OnWidgetClosed().Broadcast(this);
+	}
+
 	Super::RemoveFromParent();
 }
 
@@ -703,7 +1197,7 @@ void UUINavWidget::OnSelect_Implementation(UUINavComponent* Component)
 
 void UUINavWidget::PropagateOnSelect(UUINavComponent* Component)
 {
-	OnSelect(Component);
+	CallNativeEvent(this, EUINavWidgetEvent::OnSelect, &UUINavWidget::OnSelect, &UUINavWidget::OnSelect_Implementation, Component);
 	if (IsValid(OuterUINavWidget) && !OuterUINavWidget->bMaintainNavigationForChild)
 	{
 		OuterUINavWidget->PropagateOnSelect(Component);
@@ -717,7 +1211,7 @@ void UUINavWidget::OnStartSelect_Implementation(UUINavComponent* Component)
 
 void UUINavWidget::PropagateOnStartSelect(UUINavComponent* Component)
 {
-	OnStartSelect(Component);
+	CallNativeEvent(this, EUINavWidgetEvent::OnStartSelect, &UUINavWidget::OnStartSelect, &UUINavWidget::OnStartSelect_Implementation, Component);
 	if (IsValid(OuterUINavWidget) && !OuterUINavWidget->bMaintainNavigationForChild)
 	{
 		OuterUINavWidget->PropagateOnStartSelect(Component);
@@ -731,7 +1225,7 @@ void UUINavWidget::OnStopSelect_Implementation(UUINavComponent* Component)
 
 void UUINavWidget::PropagateOnStopSelect(UUINavComponent* Component)
 {
-	OnStopSelect(Component);
+	CallNativeEvent(this, EUINavWidgetEvent::OnStopSelect, &UUINavWidget::OnStopSelect, &UUINavWidget::OnStopSelect_Implementation, Component);
 	if (IsValid(OuterUINavWidget) && !OuterUINavWidget->bMaintainNavigationForChild)
 	{
 		OuterUINavWidget->PropagateOnStopSelect(Component);
@@ -822,7 +1316,7 @@ void UUINavWidget::OnNext_Implementation()
 
 void UUINavWidget::PropagateOnNext()
 {
-	OnNext();
+	CallNativeEvent(this, EUINavWidgetEvent::OnNext, &UUINavWidget::OnNext, &UUINavWidget::OnNext_Implementation);
 	if (IsValid(OuterUINavWidget) && !OuterUINavWidget->bMaintainNavigationForChild)
 	{
 		OuterUINavWidget->PropagateOnNext();
@@ -836,7 +1330,7 @@ void UUINavWidget::OnPrevious_Implementation()
 
 void UUINavWidget::PropagateOnPrevious()
 {
-	OnPrevious();
+	CallNativeEvent(this, EUINavWidgetEvent::OnPrevious, &UUINavWidget::OnPrevious, &UUINavWidget::OnPrevious_Implementation);
 	if (IsValid(OuterUINavWidget) && !OuterUINavWidget->bMaintainNavigationForChild)
 	{
 		OuterUINavWidget->PropagateOnPrevious();
@@ -850,7 +1344,7 @@ void UUINavWidget::OnInputChanged_Implementation(const EInputType From, const EI
 
 void UUINavWidget::PropagateOnInputChanged(const EInputType From, const EInputType To)
 {
-	OnInputChanged(From, To);
+	CallNativeEvent(this, EUINavWidgetEvent::OnInputChanged, &UUINavWidget::OnInputChanged, &UUINavWidget::OnInputChanged_Implementation, From, To);
 	if (IsValid(OuterUINavWidget) && !OuterUINavWidget->bMaintainNavigationForChild)
 	{
 		OuterUINavWidget->PropagateOnInputChanged(From, To);
@@ -890,8 +1384,7 @@ UUINavWidget* UUINavWidget::GoToWidget(TSubclassOf<UUINavWidget> NewWidgetClass,
 		return nullptr;
 	}
 
-	APlayerController* PC = Cast<APlayerController>(UINavPC->GetOwner());
-	UUINavWidget* NewWidget = CreateWidget<UUINavWidget>(PC, NewWidgetClass);
+	UUINavWidget* NewWidget = UINavPC->CreateUINavWidget(NewWidgetClass);
 	return GoToBuiltWidget(NewWidget, bRemoveParent, bDestroyParent, ZOrder);
 }
 
@@ -921,6 +1414,11 @@ UUINavWidget * UUINavWidget::GoToBuiltWidget(UUINavWidget* NewWidget, const bool
 {
 	if (NewWidget == nullptr) return nullptr;
 
+	if (UINavPC != nullptr)
+	{
+		UINavPC->RecordTelemetry(ENavigationTelemetryEvent::WidgetOpened, NewWidget->GetClass()->GetFName());
+	}
+
 	UUINavWidget* OldOuterUINavWidget = GetMostOuterUINavWidget();
 	UUINavWidget* NewOuterUINavWidget = NewWidget->GetMostOuterUINavWidget();
 
@@ -944,11 +1442,14 @@ UUINavWidget * UUINavWidget::GoToBuiltWidget(UUINavWidget* NewWidget, const bool
 	if (WidgetComp != nullptr)
 	{
 		WidgetComp->SetWidget(NewWidget);
+		NewWidget->FinishPrewarm();
 	}
 	else
 	{
+		NewWidget->CancelTeardown(true);
 		if (!bForceUsePlayerScreen && (!bUsingSplitScreen || NewWidget->bUseFullscreenWhenSplitscreen)) NewWidget->AddToViewport(ZOrder);
 		else NewWidget->AddToPlayerScreen(ZOrder);
+		NewWidget->FinishPrewarm();
 
 		APlayerController* PC = Cast<APlayerController>(UINavPC->GetOwner());
 		NewWidget->SetUserFocus(PC);
@@ -957,6 +1458,10 @@ UUINavWidget * UUINavWidget::GoToBuiltWidget(UUINavWidget* NewWidget, const bool
 			NewWidget->SetKeyboardFocus();
 		}
 	}
+	if (UINavPC != nullptr)
+	{
+		UINavPC->PushNavigationStack(OldOuterUINavWidget);
+	}
 	OldOuterUINavWidget->CleanSetup();
 	SetHoveredComponent(nullptr);
 	
@@ -965,11 +1470,17 @@ UUINavWidget * UUINavWidget::GoToBuiltWidget(UUINavWidget* NewWidget, const bool
 
 void UUINavWidget::ReturnToParent(const bool bRemoveAllParents, const int ZOrder)
 {
+	if (UINavPC != nullptr)
+	{
+		UINavPC->RecordTelemetry(ENavigationTelemetryEvent::ReturnedToParent, GetClass()->GetFName());
+	}
+
 	if (ParentWidget == nullptr)
 	{
 		if (bAllowRemoveIfRoot && UINavPC != nullptr)
 		{
 			UINavPC->SetActiveWidget(nullptr);
+			UINavPC->ClearNavigationStack();
 
 			SelectCount = 0;
 			SetSelectedComponent(nullptr);
@@ -979,8 +1490,7 @@ void UUINavWidget::ReturnToParent(const bool bRemoveAllParents, const int ZOrder
 			}
 			else
 			{
-				bReturningToParent = true;
-				RemoveFromParent();
+				Teardown(false);
 			}
 		}
 		return;
@@ -988,10 +1498,19 @@ void UUINavWidget::ReturnToParent(const bool bRemoveAllParents, const int ZOrder
 
 	SelectCount = 0;
 	SetSelectedComponent(nullptr);
+
+	// If the parent was saved in the navigation stack, its state is restored instead of setting it up again
+	FNavigationStackEntry StackEntry;
+	const bool bHasStackEntry = OuterUINavWidget == nullptr && !bRemoveAllParents && UINavPC != nullptr && UINavPC->PopNavigationStack(ParentWidget, StackEntry);
+
 	if (WidgetComp != nullptr)
 	{
 		if (bRemoveAllParents)
 		{
+			if (UINavPC != nullptr)
+			{
+				UINavPC->ClearNavigationStack();
+			}
 			WidgetComp->SetWidget(nullptr);
 		}
 		else
@@ -999,6 +1518,15 @@ void UUINavWidget::ReturnToParent(const bool bRemoveAllParents, const int ZOrder
 			if (bParentRemoved)
 			{
 				ParentWidget->ReturnedFromWidget = this;
+				if (bHasStackEntry)
+				{
+					ParentWidget->PendingWidgetState = StackEntry.State;
+				}
+			}
+			else if (bHasStackEntry)
+			{
+				ParentWidget->ReturnedFromWidget = this;
+				ParentWidget->RestoreWidgetState(StackEntry.State);
 			}
 			else
 			{
@@ -1016,10 +1544,9 @@ void UUINavWidget::ReturnToParent(const bool bRemoveAllParents, const int ZOrder
 			{
 				IUINavPCReceiver::Execute_OnRootWidgetRemoved(UINavPC->GetOwner());
 				UINavPC->SetActiveWidget(nullptr);
+				UINavPC->ClearNavigationStack();
 				ParentWidget->RemoveAllParents();
-				bReturningToParent = true;
-				RemoveFromParent();
-				Destruct();
+				Teardown(true);
 			}
 			else
 			{
@@ -1029,6 +1556,11 @@ void UUINavWidget::ReturnToParent(const bool bRemoveAllParents, const int ZOrder
 					if (IsValid(ParentWidget))
 					{
 						ParentWidget->ReturnedFromWidget = this;
+						if (bHasStackEntry)
+						{
+							ParentWidget->PendingWidgetState = StackEntry.State;
+						}
+						ParentWidget->CancelTeardown(true);
 						if (!bForceUsePlayerScreen && (!bUsingSplitScreen || ParentWidget->bUseFullscreenWhenSplitscreen)) ParentWidget->AddToViewport(ZOrder);
 						else ParentWidget->AddToPlayerScreen(ZOrder);
 					}
@@ -1037,10 +1569,16 @@ void UUINavWidget::ReturnToParent(const bool bRemoveAllParents, const int ZOrder
 				{
 					UUINavWidget* ParentOuter = ParentWidget->GetMostOuterUINavWidget();
 					ParentWidget->ReturnedFromWidget = this;
-					ParentWidget->ReconfigureSetup();
+					if (bHasStackEntry)
+					{
+						ParentWidget->RestoreWidgetState(StackEntry.State);
+					}
+					else
+					{
+						ParentWidget->ReconfigureSetup();
+					}
 				}
-				bReturningToParent = true;
-				RemoveFromParent();
+				Teardown(false);
 			}
 		}
 		else
@@ -1056,9 +1594,64 @@ void UUINavWidget::RemoveAllParents()
 	{
 		ParentWidget->RemoveAllParents();
 	}
+	Teardown(true);
+}
+
+void UUINavWidget::Teardown(const bool bDestruct)
+{
 	bReturningToParent = true;
+
+	if (GetDefault<UUINavSettings>()->bDeferWidgetTeardown && IsValid(UINavPC) && IsInViewport())
+	{
+		// Hidden right away, and ignoring input while it waits to be removed
+		bBeingRemoved = true;
+		bDestructOnTeardown = bDestruct;
+		VisibilityBeforeTeardown = GetVisibility();
+		SetVisibility(ESlateVisibility::Collapsed);
+		UINavPC->QueueWidgetTeardown(this);
+		return;
+	}
+
 	RemoveFromParent();
-	Destruct();
+	if (bDestruct)
+	{
+		Destruct();
+	}
+}
+
+void UUINavWidget::FinishTeardown()
+{
+	bReturningToParent = true;
+	RemoveFromParent();
+	SetVisibility(VisibilityBeforeTeardown);
+
+	if (bDestructOnTeardown)
+	{
+		bDestructOnTeardown = false;
+		Destruct();
+	}
+}
+
+bool UUINavWidget::CancelTeardown(const bool bRemoveFromViewport)
+{
+	if (!bBeingRemoved || !IsValid(UINavPC) || !UINavPC->CancelWidgetTeardown(this))
+	{
+		return false;
+	}
+
+	bDestructOnTeardown = false;
+	SetVisibility(VisibilityBeforeTeardown);
+
+	if (bRemoveFromViewport && IsInViewport())
+	{
+		// Adding it to the viewport again would be a no-op otherwise, so it wouldn't be set up again
+		bReturningToParent = true;
+		RemoveFromParent();
+		return true;
+	}
+
+	bBeingRemoved = false;
+	return true;
 }
 
 int UUINavWidget::GetWidgetHierarchyDepth(UWidget* Widget) const
@@ -1094,7 +1687,7 @@ void UUINavWidget::NavigatedTo(UUINavComponent* NavigatedToComponent, const bool
 
 	if (IsValid(OuterUINavWidget) && !OuterUINavWidget->bMaintainNavigationForChild)
 	{
-		OnNavigate(CurrentComponent, NavigatedToComponent);
+		CallNativeEvent(this, EUINavWidgetEvent::OnNavigate, &UUINavWidget::OnNavigate, &UUINavWidget::OnNavigate_Implementation, CurrentComponent, NavigatedToComponent);
 
 		CurrentComponent = NavigatedToComponent;
 
@@ -1129,11 +1722,11 @@ void UUINavWidget::NavigatedTo(UUINavComponent* NavigatedToComponent, const bool
 
 void UUINavWidget::CallOnNavigate(UUINavComponent* FromComponent, UUINavComponent* ToComponent)
 {
-	OnNavigate(FromComponent, ToComponent);
+	CallNativeEvent(this, EUINavWidgetEvent::OnNavigate, &UUINavWidget::OnNavigate, &UUINavWidget::OnNavigate_Implementation, FromComponent, ToComponent);
 
 	if (IsValid(FromComponent))
 	{
-		FromComponent->OnNavigatedFrom();
+		CallNativeEvent(FromComponent, EUINavComponentEvent::OnNavigatedFrom, &UUINavComponent::OnNavigatedFrom, &UUINavComponent::OnNavigatedFrom_Implementation);
 		FromComponent->ExecuteComponentActions(EComponentAction::OnNavigatedFrom);
 	}
 
@@ -1144,9 +1737,14 @@ void UUINavWidget::CallOnNavigate(UUINavComponent* FromComponent, UUINavComponen
 		{
 			PlaySound(NavigatedSound);
 		}
-		ToComponent->OnNavigatedTo();
+		CallNativeEvent(ToComponent, EUINavComponentEvent::OnNavigatedTo, &UUINavComponent::OnNavigatedTo, &UUINavComponent::OnNavigatedTo_Implementation);
 		ToComponent->ExecuteComponentActions(EComponentAction::OnNavigatedTo);
 	}
+
+	if (IsValid(UINavPC))
+	{
+		UINavPC->OnNavigated().Broadcast(this, FromComponent, ToComponent);
+	}
 }
 
 void UUINavWidget::StartedSelect()
@@ -1159,6 +1757,7 @@ void UUINavWidget::StoppedSelect()
 	if (SelectedComponent == CurrentComponent)
 	{
 		PropagateOnSelect(CurrentComponent);
+		if (IsValid(UINavPC)) UINavPC->OnSelected().Broadcast(this, CurrentComponent);
 	}
 	PropagateOnStopSelect(CurrentComponent);
 }
@@ -1227,6 +1826,75 @@ void UUINavWidget::AddParentToPath(const int IndexInParent)
 	}
 }
 
+void UUINavWidget::RegisterChildUINavWidget(UUINavWidget* ChildUINavWidget)
+{
+	if (ChildUINavWidget->bRegisteredInOuter)
+	{
+		return;
+	}
+
+	ChildUINavWidget->bRegisteredInOuter = true;
+	ChildUINavWidget->AddParentToPath(ChildUINavWidgets.Add(ChildUINavWidget));
+	InvalidateStateWidgets();
+
+	// If this widget already has its path, the child's path must start with it
+	for (int i = UINavWidgetPath.Num() - 1; i >= 0; --i)
+	{
+		ChildUINavWidget->AddParentToPath(UINavWidgetPath[i]);
+	}
+}
+
+void UUINavWidget::UnregisterChildUINavWidget(UUINavWidget* ChildUINavWidget)
+{
+	const int ChildIndex = ChildUINavWidgets.Find(ChildUINavWidget);
+	if (ChildIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	ChildUINavWidgets.RemoveAt(ChildIndex);
+	ChildUINavWidget->bRegisteredInOuter = false;
+	InvalidateStateWidgets();
+	ChildUINavWidget->RemoveParentsFromPath(UINavWidgetPath.Num() + 1);
+
+	// The children after the removed one moved down one index
+	for (int i = ChildIndex; i < ChildUINavWidgets.Num(); ++i)
+	{
+		ChildUINavWidgets[i]->DecrementPathIndex(UINavWidgetPath.Num());
+	}
+}
+
+void UUINavWidget::InvalidateStateWidgets()
+{
+	for (UUINavWidget* Widget = this; Widget != nullptr; Widget = Widget->OuterUINavWidget)
+	{
+		Widget->bStateWidgetsCached = false;
+	}
+}
+
+void UUINavWidget::RemoveParentsFromPath(const int NumParents)
+{
+	UINavWidgetPath.RemoveAt(0, FMath::Min(NumParents, UINavWidgetPath.Num()));
+
+	for (UUINavWidget* ChildUINavWidget : ChildUINavWidgets)
+	{
+		ChildUINavWidget->RemoveParentsFromPath(NumParents);
+	}
+}
+
+void UUINavWidget::DecrementPathIndex(const int PathPosition)
+{
+	if (UINavWidgetPath.IsValidIndex(PathPosition))
+	{
+		UINavWidgetPath[PathPosition]--;
+	}
+
+	for (UUINavWidget* ChildUINavWidget : ChildUINavWidgets)
+	{
+		ChildUINavWidget->DecrementPathIndex(PathPosition);
+	}
+}
+
 void UUINavWidget::SetFirstComponent(UUINavComponent* Component)
 {
 	if (IsValid(FirstComponent))
@@ -1244,6 +1912,8 @@ void UUINavWidget::SetFirstComponent(UUINavComponent* Component)
 
 void UUINavWidget::RemovedComponent(UUINavComponent* Component)
 {
+	InvalidateStateWidgets();
+
 	if (IsValid(Component) && Component == CurrentComponent)
 	{
 		SetCurrentComponent(nullptr);
@@ -1252,7 +1922,127 @@ void UUINavWidget::RemovedComponent(UUINavComponent* Component)
 	if (IsValid(FirstComponent) && Component == FirstComponent)
 	{
 		FirstComponent = nullptr;
+
+		// Another first component is only searched for once the batch ends, to avoid a scan per removed component
+		if (UUINavWidget* const BatchOwner = GetComponentBatchOwner())
+		{
+			BatchOwner->bBatchRemovedFirstComponent = true;
+		}
+		else if (OuterUINavWidget == nullptr)
+		{
+			// Nested widgets share their outermost widget's registry, so only it can pick another first component from there
+			FirstComponent = ComponentRegistry.FindFirstNavigable();
+		}
+	}
+}
+
+void UUINavWidget::BeginComponentBatch()
+{
+	ComponentBatchDepth++;
+}
+
+void UUINavWidget::EndComponentBatch()
+{
+	if (ComponentBatchDepth == 0)
+	{
+		DISPLAYERROR("EndComponentBatch called without a matching BeginComponentBatch!");
+		return;
 	}
+
+	if (--ComponentBatchDepth > 0)
+	{
+		return;
+	}
+
+	UUINavComponent* ComponentToFocus = nullptr;
+	for (UUINavComponent* const Component : BatchedComponents)
+	{
+		// Skip components that were removed again before the batch ended
+		if (!IsValid(Component) || !IsValid(Component->ParentWidget) || !Component->GetCachedWidget().IsValid())
+		{
+			continue;
+		}
+
+		if (!IsValid(Component->RegistryOwner))
+		{
+			Component->ParentWidget->RegisterComponent(Component);
+		}
+
+		if (!IsValid(Component->ParentWidget->GetFirstComponent()) && Component->CanBeNavigated())
+		{
+			Component->ParentWidget->SetFirstComponent(Component);
+			if (Component->ParentWidget->bCompletedSetup && ComponentToFocus == nullptr)
+			{
+				ComponentToFocus = Component;
+			}
+		}
+	}
+	BatchedComponents.Reset();
+
+	if (bBatchRemovedFirstComponent)
+	{
+		bBatchRemovedFirstComponent = false;
+
+		UUINavWidget* const MostOuterUINavWidget = GetMostOuterUINavWidget();
+		if (!IsValid(MostOuterUINavWidget->FirstComponent))
+		{
+			MostOuterUINavWidget->FirstComponent = MostOuterUINavWidget->ComponentRegistry.FindFirstNavigable();
+		}
+	}
+
+	if (IsValid(CurrentComponent))
+	{
+		// The components around the current one may have moved it, so update the selector once
+		if (IsSelectorValid())
+		{
+			UpdateSelectorPrevComponent = CurrentComponent;
+			UpdateSelectorNextComponent = CurrentComponent;
+			UpdateSelectorWaitForTick = 0;
+		}
+	}
+	else if (IsValid(ComponentToFocus))
+	{
+		ComponentToFocus->SetFocus();
+	}
+}
+
+void UUINavWidget::AddComponents(UPanelWidget* Panel, const TArray<UUINavComponent*>& Components)
+{
+	if (!IsValid(Panel))
+	{
+		DISPLAYERROR("AddComponents: The given panel isn't valid!");
+		return;
+	}
+
+	BeginComponentBatch();
+	for (UUINavComponent* const Component : Components)
+	{
+		if (IsValid(Component))
+		{
+			Panel->AddChild(Component);
+		}
+	}
+	EndComponentBatch();
+}
+
+UUINavWidget* UUINavWidget::GetComponentBatchOwner()
+{
+	for (UUINavWidget* Widget = this; Widget != nullptr; Widget = Widget->OuterUINavWidget)
+	{
+		if (Widget->ComponentBatchDepth > 0)
+		{
+			return Widget;
+		}
+	}
+
+	return nullptr;
+}
+
+void UUINavWidget::RegisterComponent(UUINavComponent* Component)
+{
+	UUINavWidget* const MostOuterUINavWidget = GetMostOuterUINavWidget();
+	MostOuterUINavWidget->ComponentRegistry.Add(Component, MostOuterUINavWidget);
+	InvalidateStateWidgets();
 }
 
 bool UUINavWidget::IsSelectorValid()
@@ -1355,6 +2145,7 @@ void UUINavWidget::OnReleasedComponent(UUINavComponent* Component)
 			if (bIsSelectedButton)
 			{
 				PropagateOnSelect(Component);
+				UINavPC->OnSelected().Broadcast(this, Component);
 			}
 			PropagateOnStopSelect(Component);
 		}
@@ -5,7 +5,7 @@
 #include "Data/UINavEnhancedInputActions.h"
 #include "InputMappingContext.h"
 
-FUINavigationConfig::FUINavigationConfig(const bool bAllowAccept /*= true*/, const bool bAllowBack /*= true*/, const bool bUseAnalogDirectionalInput /*= true*/, const bool bUsingThumbstickAsMouse /*= false*/)
+FUINavigationConfig::FUINavigationConfig(const bool bAllowAccept /*= true*/, const bool bAllowBack /*= true*/, const bool bUseAnalogDirectionalInput /*= true*/, const bool bUsingThumbstickAsMouse /*= false*/, const UInputMappingContext* PlayerInputContext /*= nullptr*/)
 {
 	KeyEventRules.Reset();
 	bTabNavigation = false;
@@ -14,7 +14,7 @@ FUINavigationConfig::FUINavigationConfig(const bool bAllowAccept /*= true*/, con
 
 	const UUINavSettings* const UINavSettings = GetDefault<UUINavSettings>();
 	const UUINavEnhancedInputActions* const InputActions = UINavSettings->EnhancedInputActions.LoadSynchronous();
-	const UInputMappingContext* const InputContext = UINavSettings->EnhancedInputContext.LoadSynchronous();
+	const UInputMappingContext* const InputContext = PlayerInputContext != nullptr ? PlayerInputContext : UINavSettings->EnhancedInputContext.LoadSynchronous();
 	if (InputActions == nullptr || InputContext == nullptr)
 	{
 		return;
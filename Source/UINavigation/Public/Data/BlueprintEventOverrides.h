@@ -0,0 +1,37 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+/**
+* Remembers which of a set of BlueprintNativeEvents each class overrides in Blueprint, so that
+* the events that aren't overridden can call their native implementation directly instead of
+* going through ProcessEvent
+*/
+class UINAVIGATION_API FBlueprintEventOverrides
+{
+public:
+	FBlueprintEventOverrides(const TArray<FName>& InEventNames);
+	~FBlueprintEventOverrides();
+
+	// The editor callback captures this instance, so it can't be copied
+	FBlueprintEventOverrides(const FBlueprintEventOverrides&) = delete;
+	FBlueprintEventOverrides& operator=(const FBlueprintEventOverrides&) = delete;
+
+	// Returns whether the object's class overrides in Blueprint the event with the given index in the event names
+	bool IsOverridden(const UObject* Object, const int32 EventIndex);
+
+private:
+	uint32 FindOverriddenEvents(const UClass* Class) const;
+
+	TArray<FName> EventNames;
+
+	// A bitmask of the overridden events of each class, computed the first time the class is queried
+	TMap<TObjectKey<UClass>, uint32> ClassOverrides;
+
+#if WITH_EDITOR
+	FDelegateHandle ObjectsReplacedHandle;
+#endif
+};
@@ -0,0 +1,73 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UInputModifier;
+
+enum class ESavedInputModifierType : uint8
+{
+	Negate,
+	Swizzle
+};
+
+// A modifier added by the rebinding process. Other modifiers aren't saved, as they're kept from the mapping being replaced
+struct FSavedInputModifier
+{
+	ESavedInputModifierType Type = ESavedInputModifierType::Negate;
+	// The negated axes' bits (X = 1, Y = 2, Z = 4) or the swizzle order
+	uint8 Value = 0;
+
+	bool operator==(const FSavedInputModifier& Other) const { return Type == Other.Type && Value == Other.Value; }
+
+	// Returns the shared modifier instance this was saved from
+	UINAVIGATION_API UInputModifier* GetModifier() const;
+
+	friend FArchive& operator<<(FArchive& Ar, FSavedInputModifier& Modifier);
+};
+
+struct FSavedInputMapping
+{
+	FName Key;
+	TArray<FSavedInputModifier> Modifiers;
+
+	FSavedInputMapping() {}
+
+	FSavedInputMapping(const FName InKey)
+	: Key(InKey) {}
+
+	// Saves the given modifier, if it's one added by the rebinding process
+	UINAVIGATION_API void AddModifier(const UInputModifier* Modifier);
+
+	bool operator==(const FSavedInputMapping& Other) const { return Key == Other.Key && Modifiers == Other.Modifiers; }
+
+	friend FArchive& operator<<(FArchive& Ar, FSavedInputMapping& Mapping);
+};
+
+// Every mapping of an action in a context, in the order they appear in the context
+struct FSavedActionBindings
+{
+	FString ContextPath;
+	FString ActionPath;
+	TArray<FSavedInputMapping> Mappings;
+
+	friend FArchive& operator<<(FArchive& Ar, FSavedActionBindings& ActionBindings);
+};
+
+/**
+ *	A player's rebound actions, stored as the differences from the default mappings
+ */
+struct UINAVIGATION_API FInputBindingsSave
+{
+	static const uint32 Magic;
+	static const uint16 Version;
+
+	TArray<FSavedActionBindings> Actions;
+};
+
+// Writes the save to bytes. Doesn't depend on a player or the file system, so a save can be round-tripped on its own
+UINAVIGATION_API void SerializeInputBindings(const FInputBindingsSave& BindingsSave, TArray<uint8>& OutBytes);
+
+// Reads a save written by SerializeInputBindings. Returns false if the data isn't a valid save of this or an older version
+UINAVIGATION_API bool DeserializeInputBindings(const TArray<uint8>& Bytes, FInputBindingsSave& OutBindingsSave);
@@ -0,0 +1,58 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+#include "UObject/Object.h"
+#include "InputCoreTypes.h"
+#include "InputAction.h"
+#include "Data/AxisType.h"
+#include "Data/InputContainerEnhancedActionData.h"
+#include "InputBoxData.generated.h"
+
+class UInputMappingContext;
+class UUINavInputContainer;
+
+/**
+* Holds the state of one of an input container's actions, so that it can be displayed by any input box
+*/
+UCLASS(BlueprintType)
+class UINAVIGATION_API UInputBoxData : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UInputBoxData() {}
+
+	FORCEINLINE EAxisType GetAxisType() const
+	{
+		if (!IsValid(InputActionData.Action) || InputActionData.Action->ValueType == EInputActionValueType::Boolean)
+		{
+			return EAxisType::None;
+		}
+
+		return InputActionData.AxisScale == EAxisType::Negative ? EAxisType::Negative : EAxisType::Positive;
+	}
+
+	UPROPERTY(BlueprintReadOnly, Category = "Input Box Data")
+	UUINavInputContainer* Container = nullptr;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Input Box Data")
+	UInputMappingContext* InputContext = nullptr;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Input Box Data")
+	FInputContainerEnhancedActionData InputActionData;
+
+	TArray<int> EnhancedInputGroups;
+
+	// The keys shown in each of the input box's columns
+	UPROPERTY(BlueprintReadOnly, Category = "Input Box Data")
+	TArray<FKey> Keys;
+
+	// The index of this action in the input container
+	UPROPERTY(BlueprintReadOnly, Category = "Input Box Data")
+	int Index = INDEX_NONE;
+
+	// Whether Keys was computed yet. The keys are only computed when the action is first displayed or needed
+	UPROPERTY(BlueprintReadOnly, Category = "Input Box Data")
+	bool bKeysComputed = false;
+
+};
@@ -0,0 +1,23 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// The kinds of device and the VR platform a key belongs to
+enum class EKeyClassification : uint32
+{
+	None = 0,
+	Keyboard = 1 << 0,
+	Mouse = 1 << 1,
+	Gamepad = 1 << 2,
+	Axis = 1 << 3,
+	Oculus = 1 << 4,
+	Vive = 1 << 5,
+	MixedReality = 1 << 6,
+	Valve = 1 << 7,
+	PSMove = 1 << 8,
+
+	VR = Oculus | Vive | MixedReality | Valve | PSMove
+};
+ENUM_CLASS_FLAGS(EKeyClassification);
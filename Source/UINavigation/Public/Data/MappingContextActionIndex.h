@@ -0,0 +1,96 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "EnhancedActionKeyMapping.h"
+#include "InputAction.h"
+#include "InputModifiers.h"
+#include "UObject/ObjectKey.h"
+#include "Data/InputContainerEnhancedActionData.h"
+
+/**
+* The axis properties of one of an action's mappings, inferred once from its modifiers
+*/
+struct FIndexedActionMapping
+{
+	FIndexedActionMapping() {}
+
+	FIndexedActionMapping(const FEnhancedActionKeyMapping& Mapping, const int32 InMappingIndex, const bool bInIsAxis2D) :
+		MappingIndex(InMappingIndex),
+		bIsAxis2D(bInIsAxis2D)
+	{
+		AddModifiers(Mapping.Modifiers);
+		if (Mapping.Action != nullptr)
+		{
+			AddModifiers(Mapping.Action->Modifiers);
+		}
+	}
+
+	// The mapping's index in its context
+	int32 MappingIndex = INDEX_NONE;
+
+	// The axis the key's value is swizzled to. 2D axis keys map to every axis, so it's ignored for them
+	EInputAxis SwizzleAxis = EInputAxis::X;
+
+	// The scale applied to each axis by the mapping's and the action's negate and scalar modifiers
+	FVector Scale = FVector::OneVector;
+
+	// The index in the context of the same action's mapping to the other half of this key's axis (such as S for W), if any
+	int32 OppositeMappingIndex = INDEX_NONE;
+
+	bool bIsAxis2D = false;
+
+	FORCEINLINE EInputAxis GetAxis(const EInputAxis DefaultAxis) const { return bIsAxis2D ? DefaultAxis : SwizzleAxis; }
+
+	FORCEINLINE bool IsPositive(const EInputAxis Axis) const { return Scale[static_cast<int32>(Axis)] >= 0.0; }
+
+private:
+
+	void AddModifiers(const TArray<TObjectPtr<UInputModifier>>& Modifiers)
+	{
+		for (const UInputModifier* const Modifier : Modifiers)
+		{
+			if (const UInputModifierSwizzleAxis* const Swizzle = Cast<UInputModifierSwizzleAxis>(Modifier))
+			{
+				switch (Swizzle->Order)
+				{
+				case EInputAxisSwizzle::YXZ:
+				case EInputAxisSwizzle::YZX:
+					SwizzleAxis = EInputAxis::Y;
+					break;
+				case EInputAxisSwizzle::ZXY:
+				case EInputAxisSwizzle::ZYX:
+					SwizzleAxis = EInputAxis::Z;
+					break;
+				}
+			}
+			else if (const UInputModifierNegate* const Negate = Cast<UInputModifierNegate>(Modifier))
+			{
+				Scale *= FVector(Negate->bX ? -1.0 : 1.0, Negate->bY ? -1.0 : 1.0, Negate->bZ ? -1.0 : 1.0);
+			}
+			else if (const UInputModifierScalar* const Scalar = Cast<UInputModifierScalar>(Modifier))
+			{
+				Scale *= Scalar->Scalar;
+			}
+		}
+	}
+};
+
+/**
+* The mappings of each action in an input mapping context, so that an action's mappings
+* can be found without iterating through the whole context
+*/
+struct FMappingContextActionIndex
+{
+	TMap<TObjectKey<UInputAction>, TArray<FIndexedActionMapping>> ActionMappings;
+
+	/**
+	*	Returns the action's mappings, in the order they appear in the context.
+	*	The view points to the action's array allocation, so it stays valid when this index or the map holding it grows.
+	*/
+	TArrayView<const FIndexedActionMapping> GetActionMappings(const UInputAction* Action) const
+	{
+		const TArray<FIndexedActionMapping>* const FoundMappings = ActionMappings.Find(Action);
+		return FoundMappings != nullptr ? TArrayView<const FIndexedActionMapping>(*FoundMappings) : TArrayView<const FIndexedActionMapping>();
+	}
+};
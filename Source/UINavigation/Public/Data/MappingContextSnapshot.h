@@ -0,0 +1,99 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+#include "EnhancedActionKeyMapping.h"
+#include "InputMappingContext.h"
+#include "MappingContextSnapshot.generated.h"
+
+/**
+* A copy of all the mappings of an input mapping context, which can be restored later
+*/
+USTRUCT()
+struct FMappingContextSnapshot
+{
+	GENERATED_BODY()
+
+	FMappingContextSnapshot()
+	{
+	}
+
+	FMappingContextSnapshot(const UInputMappingContext* const InputContext) :
+		Mappings(InputContext->GetMappings())
+	{
+	}
+
+	void Restore(UInputMappingContext* const InputContext) const
+	{
+		InputContext->UnmapAll();
+		for (const FEnhancedActionKeyMapping& Mapping : Mappings)
+		{
+			FEnhancedActionKeyMapping& NewMapping = InputContext->MapKey(Mapping.Action, Mapping.Key);
+			NewMapping = Mapping;
+		}
+	}
+
+	// Restores only the given action's mappings, leaving the rest of the context untouched
+	void RestoreAction(UInputMappingContext* const InputContext, const UInputAction* const Action) const
+	{
+		InputContext->UnmapAllKeysFromAction(Action);
+		for (const FEnhancedActionKeyMapping& Mapping : Mappings)
+		{
+			if (Mapping.Action == Action)
+			{
+				FEnhancedActionKeyMapping& NewMapping = InputContext->MapKey(Mapping.Action, Mapping.Key);
+				NewMapping = Mapping;
+			}
+		}
+	}
+
+	// Returns whether the given action's mappings in the context differ from the ones in this snapshot
+	bool ActionDiffers(const UInputMappingContext* const InputContext, const UInputAction* const Action) const
+	{
+		int32 SnapshotIndex = 0;
+		for (const FEnhancedActionKeyMapping& Mapping : InputContext->GetMappings())
+		{
+			if (Mapping.Action != Action) continue;
+
+			while (SnapshotIndex < Mappings.Num() && Mappings[SnapshotIndex].Action != Action) ++SnapshotIndex;
+
+			if (SnapshotIndex == Mappings.Num() || !MappingsMatch(Mapping, Mappings[SnapshotIndex]))
+			{
+				return true;
+			}
+			++SnapshotIndex;
+		}
+
+		for (; SnapshotIndex < Mappings.Num(); ++SnapshotIndex)
+		{
+			if (Mappings[SnapshotIndex].Action == Action)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// Gathers the actions mapped either in the context or in this snapshot
+	void GetActions(const UInputMappingContext* const InputContext, TArray<const UInputAction*>& OutActions) const
+	{
+		for (const FEnhancedActionKeyMapping& Mapping : InputContext->GetMappings())
+		{
+			OutActions.AddUnique(Mapping.Action);
+		}
+		for (const FEnhancedActionKeyMapping& Mapping : Mappings)
+		{
+			OutActions.AddUnique(Mapping.Action);
+		}
+	}
+
+	/**
+	*	Returns whether the mappings have the same action and key, and modifiers and triggers of the same classes and property values.
+	*	Modifiers and triggers are compared by value, as player contexts hold copies or shared instances rather than the asset's own.
+	*/
+	static bool MappingsMatch(const FEnhancedActionKeyMapping& Mapping, const FEnhancedActionKeyMapping& Other);
+
+	UPROPERTY()
+	TArray<FEnhancedActionKeyMapping> Mappings;
+
+};
@@ -0,0 +1,29 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/UINavWidgetState.h"
+#include "NavigationStackEntry.generated.h"
+
+class UUINavWidget;
+
+/**
+* A widget that was navigated away from, along with the state it had when it was left,
+* so that returning to it doesn't need to set it up again
+*/
+USTRUCT(BlueprintType)
+struct FNavigationStackEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = NavigationStack)
+	UUINavWidget* Widget = nullptr;
+
+	// Whether the widget's Slate widgets were kept. If not, they're rebuilt when it's returned to and only its state is kept
+	UPROPERTY(BlueprintReadOnly, Category = NavigationStack)
+	bool bRetained = true;
+
+	UPROPERTY(BlueprintReadOnly, Category = NavigationStack)
+	FUINavWidgetState State;
+};
@@ -0,0 +1,76 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+enum class ENavigationTelemetryEvent : uint8
+{
+	Navigated,
+	WidgetOpened,
+	ReturnedToParent,
+	InputTypeChanged,
+	KeyRebound
+};
+
+struct FNavigationTelemetryRecord
+{
+	// The value of FPlatformTime::Cycles64 when the event happened
+	uint64 Cycles = 0;
+
+	// The class of the widget involved, or the name of the rebound action
+	FName Subject;
+
+	// The rebound key's column, if any
+	int32 Value = INDEX_NONE;
+
+	ENavigationTelemetryEvent Event = ENavigationTelemetryEvent::Navigated;
+
+	// The previous and new EInputType, for InputTypeChanged records
+	uint8 FromInputType = 0;
+	uint8 ToInputType = 0;
+
+	FString ToString() const;
+};
+
+/**
+*	A fixed-size, lock-free ring buffer of telemetry records, with a single producer (the game thread)
+*	and a single consumer. Records written while the buffer is full are dropped instead of blocking.
+*/
+class UINAVIGATION_API FNavigationTelemetryBuffer
+{
+public:
+	// The capacity is rounded up to a power of two
+	explicit FNavigationTelemetryBuffer(const uint32 InCapacity);
+
+	// Only called by the producer
+	FORCEINLINE bool Write(const FNavigationTelemetryRecord& Record)
+	{
+		const uint32 CurrentHead = Head.load(std::memory_order_relaxed);
+		if (CurrentHead - Tail.load(std::memory_order_acquire) > Mask)
+		{
+			Dropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		Records[CurrentHead & Mask] = Record;
+		Head.store(CurrentHead + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Only called by the consumer. Passes every written record to the callback, oldest first, and returns how many there were
+	int32 Drain(TFunctionRef<void(const FNavigationTelemetryRecord&)> Callback);
+
+	// Returns how many records were dropped because the buffer was full, and resets the count
+	uint32 ConsumeNumDropped() { return Dropped.exchange(0, std::memory_order_relaxed); }
+
+private:
+	TArray<FNavigationTelemetryRecord> Records;
+	uint32 Mask = 0;
+
+	// Kept in separate cache lines so that the producer and consumer don't invalidate each other's
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> Head { 0 };
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> Tail { 0 };
+	std::atomic<uint32> Dropped { 0 };
+};
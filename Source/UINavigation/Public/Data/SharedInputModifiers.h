@@ -0,0 +1,36 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "UObject/Object.h"
+#include "InputModifiers.h"
+#include "SharedInputModifiers.generated.h"
+
+/**
+ * Holds the negate and swizzle modifiers added to mappings when rebinding, so that every mapping
+ * reuses the same instances instead of creating new ones on each rebind.
+ * The returned modifiers are shared, so they must never be modified.
+ */
+UCLASS(Transient)
+class UINAVIGATION_API USharedInputModifiers : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	static UInputModifierNegate* GetNegateModifier(const bool bX, const bool bY, const bool bZ);
+
+	static UInputModifierSwizzleAxis* GetSwizzleModifier(const EInputAxisSwizzle Order);
+
+protected:
+
+	static USharedInputModifiers* Get();
+
+	// Indexed by the negated axes (X = 1, Y = 2, Z = 4)
+	UPROPERTY()
+	UInputModifierNegate* NegateModifiers[8];
+
+	// Indexed by the swizzle order
+	UPROPERTY()
+	UInputModifierSwizzleAxis* SwizzleModifiers[6];
+};
@@ -0,0 +1,55 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UINavComponentRegistry.generated.h"
+
+class UUINavComponent;
+class UUINavWidget;
+
+/**
+* The components of an outermost UINavWidget and of its nested widgets, stored as parallel arrays
+* so that navigation queries scan tight arrays instead of querying each component
+*/
+USTRUCT()
+struct UINAVIGATION_API FUINavComponentRegistry
+{
+	GENERATED_BODY()
+
+public:
+
+	void Add(UUINavComponent* Component, UUINavWidget* Owner);
+
+	// Components are swapped out, so the order of the remaining ones isn't kept
+	void Remove(UUINavComponent* Component);
+
+	// Moves the other registry's components into this one
+	void Append(FUINavComponentRegistry& Other, UUINavWidget* Owner);
+
+	void Reset();
+
+	FORCEINLINE int32 Num() const { return Components.Num(); }
+
+	FORCEINLINE UUINavComponent* GetComponent(const int32 Index) const { return Components[Index]; }
+
+	FORCEINLINE bool IsNavigable(const int32 Index) const { return NavigableFlags[Index]; }
+
+	FORCEINLINE void SetNavigable(const int32 Index, const bool bNavigable) { NavigableFlags[Index] = bNavigable; }
+
+	// Returns the earliest registered component that can be navigated to, or nullptr if there's none
+	UUINavComponent* FindFirstNavigable() const;
+
+private:
+
+	UPROPERTY()
+	TArray<UUINavComponent*> Components;
+
+	// Whether each component can be navigated, kept up to date by the components themselves
+	TArray<bool> NavigableFlags;
+
+	// When each component was registered, since removing components changes the order of the arrays
+	TArray<uint32> RegistrationOrders;
+
+	uint32 NextRegistrationOrder = 0;
+};
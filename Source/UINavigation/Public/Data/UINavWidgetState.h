@@ -0,0 +1,88 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UINavWidgetState.generated.h"
+
+class UUINavWidget;
+class UUINavComponent;
+class UUINavHorizontalComponent;
+class UUINavLazyWidget;
+class UScrollBox;
+
+/**
+* The navigation state of a UINavWidget and of its nested widgets, so that the widget can be
+* destroyed and rebuilt, or reopened, exactly as it was.
+* Widgets and components are stored as their index in widget tree order, so the state can be restored
+* on a different instance of the same widget class.
+*/
+USTRUCT(BlueprintType)
+struct UINAVIGATION_API FUINavWidgetState
+{
+	GENERATED_BODY()
+
+	// The index of the widget navigation was in, among the widget and its nested widgets (the widget itself being 0)
+	UPROPERTY(BlueprintReadOnly, SaveGame, Category = UINavWidgetState)
+	int32 FocusedWidgetIndex = INDEX_NONE;
+
+	// Each widget's CurrentComponent, as an index among all of the widget's components
+	UPROPERTY(BlueprintReadOnly, SaveGame, Category = UINavWidgetState)
+	TArray<int32> CurrentComponentIndices;
+
+	// The scroll offset of each scroll box
+	UPROPERTY(BlueprintReadOnly, SaveGame, Category = UINavWidgetState)
+	TArray<float> ScrollOffsets;
+
+	// The option index of each horizontal component
+	UPROPERTY(BlueprintReadOnly, SaveGame, Category = UINavWidgetState)
+	TArray<int32> HorizontalComponentValues;
+
+	// Whether each lazy widget placeholder was built. They're built again on restore before the other indices are used, so that those point to the same widgets
+	UPROPERTY(BlueprintReadOnly, SaveGame, Category = UINavWidgetState)
+	TArray<bool> BuiltLazyWidgets;
+
+	UPROPERTY(BlueprintReadOnly, SaveGame, Category = UINavWidgetState)
+	FVector2D SelectorPosition = FVector2D::ZeroVector;
+
+	// Whether the selector position was captured, in which case restoring doesn't wait for the geometry to place the selector
+	UPROPERTY(BlueprintReadOnly, SaveGame, Category = UINavWidgetState)
+	bool bHasSelectorPosition = false;
+
+	FORCEINLINE bool IsEmpty() const { return CurrentComponentIndices.Num() == 0; }
+
+	friend UINAVIGATION_API FArchive& operator<<(FArchive& Ar, FUINavWidgetState& State);
+};
+
+/**
+* The widgets a UINavWidget's navigation state is made of, in widget tree order
+*/
+USTRUCT()
+struct UINAVIGATION_API FUINavStateWidgets
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<UUINavWidget*> Widgets;
+
+	UPROPERTY()
+	TArray<UUINavComponent*> Components;
+
+	UPROPERTY()
+	TArray<UScrollBox*> ScrollBoxes;
+
+	UPROPERTY()
+	TArray<UUINavHorizontalComponent*> HorizontalComponents;
+
+	UPROPERTY()
+	TArray<UUINavLazyWidget*> LazyWidgets;
+
+	void Reset()
+	{
+		Widgets.Reset();
+		Components.Reset();
+		ScrollBoxes.Reset();
+		HorizontalComponents.Reset();
+		LazyWidgets.Reset();
+	}
+};
@@ -4,6 +4,7 @@
 
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Data/InputRestriction.h"
+#include "Data/KeyClassification.h"
 #include "UINavBlueprintFunctionLibrary.generated.h"
 
 class UInputAction;
@@ -97,5 +98,11 @@ public:
 
 	UFUNCTION(BlueprintPure, Category = UINavigationLibrary)
 	static bool IsKeyInCategory(const FKey Key, const FString Category);
+
+	// Returns the key's classification, which is computed only once per key
+	static EKeyClassification GetKeyClassification(const FKey& Key);
+
+	// Returns the classification of the keys of the VR platform being used
+	static EKeyClassification GetHMDKeyClassification();
 	
 };
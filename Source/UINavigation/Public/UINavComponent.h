@@ -50,6 +50,9 @@ public:
 	virtual void NativeDestruct() override;
 
 	virtual bool Initialize() override;
+
+	// Whether focus can stay on a Slate widget of the given type, instead of being moved back to the NavButton
+	static bool IsFocusableWidgetType(const FName WidgetType);
 	
 	UFUNCTION(BlueprintNativeEvent, Category = UINavComponent)
 	void OnNavigatedTo();
@@ -107,7 +110,14 @@ public:
 	bool UseComponentAnimation() const { return bUseComponentAnimation; }
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavComponent)
-	bool CanBeNavigated() const;
+	FORCEINLINE bool CanBeNavigated() const { return bCanBeNavigated; }
+
+	// Recomputes whether this component can be navigated, from its and its NavButton's visibility and enabled state
+	void RefreshNavigable();
+
+	virtual void SetVisibility(ESlateVisibility InVisibility) override;
+
+	virtual void SetIsEnabled(bool bInIsEnabled) override;
 
 protected:
 
@@ -123,6 +133,11 @@ protected:
 
 	EButtonStyle GetStyleFromButtonState();
 
+	void OnNavButtonFieldChanged(UObject* Object, UE::FieldNotification::FFieldId FieldId);
+
+	// Only recomputed when this component's or its NavButton's visibility or enabled state change, so that navigation queries just read it
+	bool bCanBeNavigated = true;
+
 public:
 
 	UPROPERTY(BlueprintReadOnly, meta = (BindWidget), Category = UINavComponent)
@@ -134,6 +149,12 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = UINavComponent)
 	UUINavWidget* ParentWidget = nullptr;
 
+	// The widget whose component registry this component is in, and its index there
+	UPROPERTY()
+	UUINavWidget* RegistryOwner = nullptr;
+
+	int32 RegistryIndex = INDEX_NONE;
+
 	UPROPERTY(BlueprintAssignable, Category = "Appearance|Event")
 	FOnClickedEvent OnClicked;
 	DECLARE_EVENT(UUserWidget, FNativeOnClickedEvent);
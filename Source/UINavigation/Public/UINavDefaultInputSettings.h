@@ -7,6 +7,7 @@
 #include "InputMappingContext.h"
 #include "Data/UINavEnhancedInputActions.h"
 #include "Data/UINavEnhancedActionKeyMapping.h"
+#include "Data/MappingContextSnapshot.h"
 #include "UINavDefaultInputSettings.generated.h"
 
 USTRUCT(BlueprintType)
@@ -38,4 +39,10 @@ public:
 	// A map for each Input Context in your game and its respective Default Input Context Mappings
 	UPROPERTY(config)
 	TMap<TSoftObjectPtr<UInputMappingContext>, FInputMappingArray> DefaultEnhancedInputMappings;
+
+	// The loaded default mappings of each Input Context, built once from DefaultEnhancedInputMappings so that resets don't load anything
+	UPROPERTY(Transient)
+	TMap<const UInputMappingContext*, FMappingContextSnapshot> DefaultMappingsSnapshots;
+
+	FORCEINLINE const FMappingContextSnapshot* GetDefaultMappings(const UInputMappingContext* InputContext) const { return DefaultMappingsSnapshots.Find(InputContext); }
 };
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Blueprint/UserWidget.h"
+#include "Blueprint/IUserObjectListEntry.h"
 #include "Data/AxisType.h"
 #include "Data/InputContainerEnhancedActionData.h"
 #include "Data/InputRebindData.h"
@@ -16,13 +17,15 @@ class UUINavInputComponent;
 class UInputAction;
 class UInputMappingContext;
 class UInputSettings;
+class UInputBoxData;
 struct FInputAxisKeyMapping;
+struct FIndexedActionMapping;
 
 /**
 * This class contains the logic for rebinding input keys to their respective actions
 */
 UCLASS()
-class UINAVIGATION_API UUINavInputBox : public UUserWidget
+class UINAVIGATION_API UUINavInputBox : public UUserWidget, public IUserObjectListEntry
 {
 	GENERATED_BODY()
 	
@@ -37,6 +40,8 @@ protected:
 
 	virtual FNavigationReply NativeOnNavigation(const FGeometry& MyGeometry, const FNavigationEvent& InNavigationEvent, const FNavigationReply& InDefaultReply) override;
 
+	virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
+
 	bool UpdateKeyIconForKey(const int Index);
 	FText GetKeyText(const int Index);
 	void UpdateKeyDisplay(const int Index);
@@ -56,6 +61,9 @@ protected:
 	void GetEnhancedMappingsForAction(const UInputAction* Action, const EInputAxis& Axis, const int Index, TArray<int32>& OutMappingIndices);
 	void GetKeyMappingNegateAxes(const FKey& OldAxisKey, bool& bNegateX, bool& bNegateY, bool& bNegateZ);
 
+	// Returns the action index entry of this input box's action's first mapping to the given key, if there's one
+	const FIndexedActionMapping* FindIndexedMapping(const FKey& Key) const;
+
 public:
 
 	UUINavInputBox(const FObjectInitializer& ObjectInitializer);
@@ -64,6 +72,9 @@ public:
 	void CreateEnhancedInputKeyWidgets();
 
 	void CreateKeyWidgets();
+	void CreateKeyWidgetsFromData();
+	void SetInputBoxData(UInputBoxData* NewInputBoxData);
+	void StoreKeysInData();
 	bool TrySetupNewKey(const FKey NewKey, const int KeyIndex, UUINavInputComponent* const NewInputButton);
 	void ResetKeyWidgets();
 	void UpdateInputKey(const FKey NewKey, int Index = -1, const bool bSkipChecks = false);
@@ -72,15 +83,15 @@ public:
 	void TryMapEnhancedAxisKey(const FKey& NewKey, const int32 Index);
 	void TryMap2DAxisKey(const FKey& NewMappingKey, const int Index);
 	void UnmapEnhancedAxisKey(const FKey& NewAxisKey, const FKey& OldAxisKey, const FKey& NewKey, const int32 Index, const bool bNegateX, const bool bNegateY, const bool bNegateZ);
-	void AddRelevantModifiers(const FInputContainerEnhancedActionData& ActionData, FEnhancedActionKeyMapping& Mapping);
-	void ApplyNegateModifiers(UUINavInputBox* InputBox, FEnhancedActionKeyMapping& Mapping, const bool bNegateX, const bool bNegateY, const bool bNegateZ);
+	static void AddRelevantModifiers(const FInputContainerEnhancedActionData& ActionData, FEnhancedActionKeyMapping& Mapping);
+	static void ApplyNegateModifiers(const FInputContainerEnhancedActionData& ActionData, FEnhancedActionKeyMapping& Mapping, const bool bNegateX, const bool bNegateY, const bool bNegateZ);
 	void CancelUpdateInputKey(const ERevertRebindReason Reason);
 	void RevertToKeyText(const int Index);
 
 	int ContainsKey(const FKey CompareKey) const;
 	FORCEINLINE bool IsAxis() const { return IS_AXIS; }
 	FORCEINLINE bool WantsAxisKey() const;
-	FORCEINLINE FKey GetKey(const int Index) { return Index >= 0 && Index < Keys.Num() ? Keys[Index] : FKey(); }
+	FORCEINLINE FKey GetKey(const int Index) const { return Index >= 0 && Index < Keys.Num() ? Keys[Index] : FKey(); }
 
 	EAxisType AxisType = EAxisType::None;
 
@@ -110,6 +121,10 @@ public:
 
 	UPROPERTY(BlueprintReadOnly, Category = "Enhanced Input")
 	FInputContainerEnhancedActionData InputActionData;
+
+	// The data this input box is displaying, when used in a virtualized input container
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Input")
+	UInputBoxData* InputBoxData = nullptr;
 	
 	FInputRebindData InputData = FInputRebindData();
 
@@ -14,6 +14,9 @@
 #include "UINavInputContainer.generated.h"
 
 class UPromptDataBase;
+class UInputBoxData;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnInputBoxesCreatedEvent);
 
 /**
 * This class contains the logic for aggregating several input boxes
@@ -28,16 +31,68 @@ protected:
 
 	void SetupInputBoxes();
 	void CreateInputBoxes();
+	void CreateInputBox(const int Index);
+	void CreateInputBoxesWithinBudget();
+	void FinishCreatingInputBoxes();
+	void CreateInputBoxesData();
+	void RefreshInputBoxData(UInputBoxData* InputBoxData);
+	void ComputeInputBoxData(UInputBoxData* InputBoxData) const;
+	void ComputePendingInputBoxesData() const;
+	void RefreshActionsKeys(const TArray<const UInputAction*>& Actions);
+	UUINavInputBox* GetOffscreenInputBox(UInputBoxData* InputBoxData);
+	void CacheAllowedKeys();
+
+	bool bCreatingInputBoxes = false;
+
+	// Hashed copies of KeyWhitelist and KeyBlacklist, so that listening input boxes can filter keys in constant time
+	TSet<FKey> KeyWhitelistSet;
+	TSet<FKey> KeyBlacklistSet;
+
+	// The keys that respect each of the columns' distinct input restrictions
+	TArray<TSet<FKey>> RestrictionAllowedKeys;
+
+	// The index in RestrictionAllowedKeys of each column's allowed keys
+	TArray<int32> ColumnAllowedKeysIndices;
+
+	// The keys that existed when the allowed keys were cached. Other keys are checked against the restriction directly
+	TSet<FKey> CachedKeys;
+
+	// In a virtualized input container, the indices of the actions using each key
+	TMap<FKey, TArray<int32>> KeyActionIndices;
+
+	// In a virtualized input container, the number of actions whose keys weren't computed yet
+	int32 NumPendingInputBoxesData = 0;
 
 	UPROPERTY(BlueprintReadWrite, meta = (BindWidget), Category = "UINav Input")
 	class UPanelWidget* InputBoxesPanel = nullptr;
 
+	/*
+	If bound, the input container is virtualized: the input boxes are entries of this list view
+	(its entry widget class should be InputBox_BP) and only the visible ones are created.
+	InputBoxesPanel is left empty in that case.
+	*/
+	UPROPERTY(BlueprintReadWrite, meta = (BindWidgetOptional), Category = "UINav Input")
+	class UListView* InputBoxesList = nullptr;
+
+	// Used to compute the keys of the actions that aren't being displayed in a virtualized input container, when they're needed
+	UPROPERTY()
+	UUINavInputBox* DetachedInputBox = nullptr;
+
+	/*
+	Stands in for the actions that aren't being displayed in a virtualized input container when an input box is needed for them.
+	Kept apart from DetachedInputBox, which is reassigned whenever an action's keys are refreshed.
+	*/
+	UPROPERTY()
+	UUINavInputBox* OffscreenInputBox = nullptr;
+
 	class UUINavWidget* ParentWidget = nullptr;
 
 public:
 
 	virtual void NativeConstruct() override;
 
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+
 	/**
 	*	Called when a new input box is added
 	*/
@@ -65,7 +120,7 @@ public:
 	/**
 	*	Called when the player presses a key being used by another action
 	*/
-	bool RequestKeySwap(const FInputCollisionData& InputCollisionData, const int CurrentInputIndex, const int CollidingInputIndex) const;
+	bool RequestKeySwap(const FInputCollisionData& InputCollisionData, const int CurrentInputIndex, const int CollidingInputIndex);
 
 	UFUNCTION(BlueprintCallable, Category = "UINav Input")
 	void ResetKeyMappings();
@@ -75,6 +130,11 @@ public:
 
 	ERevertRebindReason CanRegisterKey(class UUINavInputBox* InputBox, const FKey NewKey, const int Index, int& OutCollidingActionIndex, int& OutCollidingKeyIndex);
 
+	/**
+	*	Stores the keys computed for one of a virtualized input container's actions and indexes them for collision checks
+	*/
+	void StoreInputBoxDataKeys(UInputBoxData* InputBoxData, const TArray<FKey>& NewKeys);
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UINav Input")
 	bool CanUseKey(class UUINavInputBox* InputBox, const FKey CompareKey, int& OutCollidingActionIndex, int& OutCollidingKeyIndex) const;
 
@@ -91,6 +151,27 @@ public:
 	UUINavInputBox* GetOppositeInputBox(const FInputContainerEnhancedActionData& ActionData);
 	UUINavInputBox* GetOppositeInputBox(const FName& InputName, const EAxisType AxisType);
 
+	const FInputContainerEnhancedActionData* GetOppositeInputActionData(const FInputContainerEnhancedActionData& ActionData) const;
+
+	FORCEINLINE bool HasOppositeInputAction(const FInputContainerEnhancedActionData& ActionData) const { return GetOppositeInputActionData(ActionData) != nullptr; }
+
+	FKey GetOppositeInputKey(const FInputContainerEnhancedActionData& ActionData, const int KeyIndex) const;
+
+	int GetInputBoxIndex(const UUINavInputBox* InputBox) const;
+
+	/**
+	*	Returns the input box for the action at the given index.
+	*	In a virtualized input container, if that action isn't being displayed, a single cached offscreen input box is set up for it,
+	*	so the returned input box is only valid until the next call.
+	*/
+	UUINavInputBox* GetInputBoxForAction(const int Index);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UINav Input")
+	FORCEINLINE bool IsVirtualized() const { return InputBoxesList != nullptr; }
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UINav Input")
+	FORCEINLINE bool IsCreatingInputBoxes() const { return bCreatingInputBoxes; }
+
 	void GetAxisPropertiesFromMapping(const FEnhancedActionKeyMapping& ActionMapping, bool& bOutPositive, EInputAxis& OutAxis) const;
 
 	void GetInputRebindData(const int InputIndex, FInputRebindData& RebindData) const;
@@ -109,6 +190,10 @@ public:
 
 	UPROPERTY(BlueprintReadOnly, Category = "UINav Input")
 	TArray<UUINavInputBox*> InputBoxes;
+
+	// The state of each action, used instead of InputBoxes when the input container is virtualized
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Input")
+	TArray<UInputBoxData*> InputBoxesData;
 	
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UINav Input")
 	TMap<UInputMappingContext*, FInputContainerEnhancedActionDataArray> EnhancedInputs;
@@ -156,6 +241,26 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UINav Input")
 	bool bCollapseInputBoxes = false;
 
+	/*
+	Indicates whether the input boxes should be created over several frames instead of all at once.
+	Boxes are created in the order they're displayed, so the ones at the top are usable first.
+	Doesn't apply to a virtualized input container, which only computes each action's keys when they're first needed.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UINav Input")
+	bool bTimeSliceInputBoxCreation = false;
+
+	/*
+	The maximum time, in milliseconds, spent creating input boxes in each frame
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UINav Input", meta = (EditCondition = "bTimeSliceInputBoxCreation", ClampMin = "0.1"))
+	float InputBoxCreationBudgetMs = 2.0f;
+
+	/*
+	Called once all the input boxes have been created
+	*/
+	UPROPERTY(BlueprintAssignable, Category = "UINav Input")
+	FOnInputBoxesCreatedEvent OnInputBoxesCreated;
+
 	FPromptWidgetDecided DecidedCallback;
 
 	//The text used for empty key buttons
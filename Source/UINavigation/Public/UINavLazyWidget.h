@@ -0,0 +1,59 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "Components/ContentWidget.h"
+#include "UINavLazyWidget.generated.h"
+
+class UUINavWidget;
+class SUINavLazyWidgetBox;
+
+/**
+* A placeholder for a nested UINavWidget that is only built when navigation first enters it, or when it's prefetched,
+* so that widgets with many pages only pay for the ones the player visits
+*/
+UCLASS()
+class UINAVIGATION_API UUINavLazyWidget : public UContentWidget
+{
+	GENERATED_BODY()
+
+public:
+
+	// The class of the nested widget built in place of this placeholder
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = UINavLazyWidget)
+	TSubclassOf<UUINavWidget> WidgetClass;
+
+	/**
+	*	Builds the nested widget if it wasn't built yet
+	*
+	*	@return The nested widget
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavLazyWidget)
+	UUINavWidget* Build();
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavLazyWidget)
+	FORCEINLINE UUINavWidget* GetBuiltWidget() const { return BuiltWidget; }
+
+	FORCEINLINE bool IsBuilt() const { return BuiltWidget != nullptr; }
+
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+#if WITH_EDITOR
+	virtual const FText GetPaletteCategory() override;
+#endif
+
+protected:
+
+	UPROPERTY()
+	UUINavWidget* BuiltWidget = nullptr;
+
+	TSharedPtr<SUINavLazyWidgetBox> MyBox;
+
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+
+	virtual void OnSlotAdded(UPanelSlot* InSlot) override;
+	virtual void OnSlotRemoved(UPanelSlot* InSlot) override;
+
+	// Called when navigation enters the empty placeholder
+	void HandlePlaceholderFocused();
+};
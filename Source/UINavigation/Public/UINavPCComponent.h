@@ -15,20 +15,40 @@
 #include "Input/Reply.h"
 #include "InputAction.h"
 #include "Data/InputContainerEnhancedActionData.h"
+#include "Data/MappingContextSnapshot.h"
+#include "Data/MappingContextActionIndex.h"
+#include "Data/NavigationTelemetry.h"
+#include "Data/NavigationStackEntry.h"
 #include "Delegates/DelegateCombinations.h"
 #include "Misc/CoreMiscDefines.h"
+#include "Async/Future.h"
 #include "UINavPCComponent.generated.h"
 
 class APlayerController;
 class FUINavInputProcessor;
+class FUINavigationConfig;
 class UUINavInputBox;
 class UTexture2D;
 class UUINavWidget;
+class UUINavComponent;
 class UInputMappingContext;
+class UEnhancedInputLocalPlayerSubsystem;
+struct FStreamableHandle;
+struct FInputBindingsSave;
 
 DECLARE_DELEGATE_OneParam(FMouseKeyDelegate, FKey);
+DECLARE_MULTICAST_DELEGATE(FInputContextsCachedDelegate);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInputTypeChangedDelegate, EInputType, InputType);
 
+// Native navigation events, cheaper to broadcast than dynamic delegates and Blueprint events
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FUINavNavigatedEvent, UUINavWidget* /*Widget*/, UUINavComponent* /*FromComponent*/, UUINavComponent* /*ToComponent*/);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FUINavSelectedEvent, UUINavWidget* /*Widget*/, UUINavComponent* /*Component*/);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FUINavInputTypeChangedEvent, EInputType /*From*/, EInputType /*To*/);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FUINavActiveWidgetChangedEvent, UUINavWidget* /*OldActiveWidget*/, UUINavWidget* /*NewActiveWidget*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FUINavWidgetEvent, UUINavWidget* /*Widget*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FUINavBindingsRevertedEvent, const TArray<const UInputAction*>& /*Actions*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FUINavBindingsChangedEvent, const TArray<const UInputAction*>& /*Actions*/);
+
 USTRUCT(BlueprintType)
 struct FAxis2D_Keys
 {
@@ -84,6 +104,18 @@ protected:
 
 	TSharedPtr<FUINavInputProcessor> SharedInputProcessor = nullptr;
 
+	// The navigation config last given to Slate by this player
+	TSharedPtr<FUINavigationConfig> NavigationConfig = nullptr;
+
+	FUINavNavigatedEvent NavigatedEvent;
+	FUINavSelectedEvent SelectedEvent;
+	FUINavInputTypeChangedEvent InputTypeChangedEvent;
+	FUINavActiveWidgetChangedEvent ActiveWidgetChangedEvent;
+	FUINavWidgetEvent WidgetOpenedEvent;
+	FUINavWidgetEvent WidgetClosedEvent;
+	FUINavBindingsRevertedEvent BindingsRevertedEvent;
+	FUINavBindingsChangedEvent BindingsChangedEvent;
+
 	FVector2D ThumbstickDelta = FVector2D::ZeroVector;
 
 	ECountdownPhase CountdownPhase = ECountdownPhase::None;
@@ -105,12 +137,104 @@ protected:
 	UPROPERTY()
 	TArray<const UInputMappingContext*> CachedInputContexts;
 
+	bool bInputContextsCached = false;
+
+	TSharedPtr<FStreamableHandle> InputContextsLoadHandle;
+
+	TArray<FSoftObjectPath> InputContextPaths;
+
+	// Widgets created ahead of time, waiting to be used by GoToWidget
+	UPROPERTY()
+	TMap<TSubclassOf<UUINavWidget>, UUINavWidget*> PrewarmedWidgets;
+
+	// Keeps the prewarmed widget classes and key icons loaded
+	TSharedPtr<FStreamableHandle> PrewarmLoadHandle;
+
+	// The widgets that were navigated away from, with the most recent one last
+	UPROPERTY()
+	TArray<FNavigationStackEntry> NavigationStack;
+
+	// Closed widgets that are hidden and waiting to be removed, when widget teardown is deferred
+	UPROPERTY()
+	TArray<UUINavWidget*> TeardownQueue;
+
+	int BindingTransactionDepth = 0;
+
+	bool bRebuildMappingsPending = false;
+
+	// This player's copies of the input contexts whose mappings they've modified, keyed by the original context
+	UPROPERTY()
+	TMap<const UInputMappingContext*, UInputMappingContext*> PlayerInputContexts;
+
+	// The priority each player copy was given in the subsystem, keyed by the original context, so that the original can be put back in its place
+	TMap<const UInputMappingContext*, int32> PlayerInputContextPriorities;
+
+	// Each queried context's mappings grouped by action. Key changes update a context's index in place, other changes discard it
+	mutable TMap<TObjectKey<UInputMappingContext>, FMappingContextActionIndex> ActionIndices;
+
+	// The mappings each context had before being modified in the current binding transaction
+	UPROPERTY()
+	TMap<UInputMappingContext*, FMappingContextSnapshot> BindingTransactionSnapshots;
+
+	// Time left until the changed bindings are saved. Negative if there are no unsaved changes
+	float BindingsSaveCountdown = -1.0f;
+
+	TFuture<bool> BindingsSaveTask;
+
+	// Only created if navigation telemetry is enabled in the UINav settings
+	TUniquePtr<FNavigationTelemetryBuffer> TelemetryBuffer;
+
+	// Time left until the telemetry is next written to its file
+	float TelemetryFlushCountdown = 0.0f;
+
+	// Drains the telemetry buffer into its file. While it's running, it's the buffer's only consumer
+	TFuture<void> TelemetryFlushTask;
+
 	/*************************************************************************/
 
 	void SetTimer(const EUINavigation NavigationDirection);
 
 	void CacheGameInputContexts();
 
+	void OnInputContextsLoaded();
+
+	void RebuildMappingsForContexts(const TArray<UInputMappingContext*>& InputContexts);
+
+	UEnhancedInputLocalPlayerSubsystem* GetEnhancedInputSubsystem() const;
+
+	void BuildActionIndex(const UInputMappingContext* InputContext, FMappingContextActionIndex& OutActionIndex) const;
+
+	// Finds the mapping to the other half of each mapping's key axis, among the same action's mappings
+	void LinkOppositeMappings(const TArray<FEnhancedActionKeyMapping>& Mappings, TArray<FIndexedActionMapping>& IndexedMappings) const;
+
+	// Replaces the original input contexts added to the player's subsystem with the player's copies
+	void UsePlayerInputContexts(UEnhancedInputLocalPlayerSubsystem* Subsystem);
+
+	// Replaces the player's copies in the subsystem with their original contexts, at the same priorities
+	void RestoreOriginalInputContexts();
+
+	void RevertBindingTransactionChanges();
+
+	// Gathers the actions whose mappings differ from the ones the binding transaction started with
+	void GetBindingTransactionChangedActions(TArray<const UInputAction*>& OutActions) const;
+
+	static bool IntroducesKeyConflicts(const TArray<FEnhancedActionKeyMapping>& OldMappings, const TArray<FEnhancedActionKeyMapping>& NewMappings);
+
+	FString GetInputBindingsSavePath() const;
+
+	void LoadInputBindings();
+
+	void SaveInputBindings(const bool bWaitForWrite = false);
+
+	// Gathers the actions whose mappings differ from the default ones
+	void GatherInputBindingChanges(FInputBindingsSave& OutBindingsSave) const;
+
+	void ApplyInputBindingChanges(const FInputBindingsSave& BindingsSave);
+
+	FString GetNavigationTelemetryPath() const;
+
+	void FlushNavigationTelemetry(const bool bWaitForWrite = false);
+
 	void TryResetDefaultInputs();
 
 	/**
@@ -272,6 +396,42 @@ public:
 	UPROPERTY(BlueprintAssignable, BlueprintCallable, BlueprintReadOnly, Category = UINavController)
 	FInputTypeChangedDelegate InputTypeChangedDelegate;
 
+	// Broadcast once, when the game's Input Mapping Contexts have finished loading
+	FInputContextsCachedDelegate InputContextsCachedDelegate;
+
+	/**
+	*	Native navigation events. Subscribing returns a handle that should be used to unsubscribe.
+	*	Each is broadcast once per occurrence, not once per outer widget.
+	*/
+
+	// Broadcast when a widget's navigated component changes
+	FUINavNavigatedEvent& OnNavigated() { return NavigatedEvent; }
+
+	// Broadcast when a component is selected
+	FUINavSelectedEvent& OnSelected() { return SelectedEvent; }
+
+	FUINavInputTypeChangedEvent& OnInputTypeChanged() { return InputTypeChangedEvent; }
+
+	FUINavActiveWidgetChangedEvent& OnActiveWidgetChanged() { return ActiveWidgetChangedEvent; }
+
+	// Broadcast when a root UINavWidget (one that isn't nested in another) finishes its setup
+	FUINavWidgetEvent& OnWidgetOpened() { return WidgetOpenedEvent; }
+
+	// Broadcast when a root UINavWidget is removed from its parent
+	FUINavWidgetEvent& OnWidgetClosed() { return WidgetClosedEvent; }
+
+	// Broadcast when a binding transaction is rolled back, with the actions whose keys were reverted
+	FUINavBindingsRevertedEvent& OnBindingsReverted() { return BindingsRevertedEvent; }
+
+	// Broadcast when binding changes made through RebindActionKey are applied, with the actions whose keys changed
+	FUINavBindingsChangedEvent& OnBindingsChanged() { return BindingsChangedEvent; }
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavController)
+	FORCEINLINE bool AreInputContextsCached() const { return bInputContextsCached; }
+
+	// Gathers the paths of the input contexts to cache, as configured in the UINav settings
+	static void GatherInputContextPaths(TArray<FSoftObjectPath>& OutContextPaths);
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavController)
 	FORCEINLINE bool AllowsAllMenuInput() const { return bAllowDirectionalInput && bAllowSelectInput && bAllowReturnInput && bAllowSectionInput; }
 
@@ -313,6 +473,143 @@ public:
 	bool IgnoreFocusByNavigation() const { return bIgnoreFocusByNavigation; }
 
 	void RequestRebuildMappings();
+
+	/**
+	*	Starts collecting binding changes, so that they're applied with a single mapping rebuild when committed.
+	*	Transactions can be nested, in which case only the outermost commit applies the changes.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "UINavController|Bindings")
+	void BeginBindingTransaction();
+
+	/**
+	*	Applies the binding changes made since BeginBindingTransaction.
+	*
+	*	@param bAllowKeyConflicts If false, the transaction is rolled back if it made a key be used by more than one action of the same context
+	*	@return Whether the changes were kept
+	*/
+	UFUNCTION(BlueprintCallable, Category = "UINavController|Bindings")
+	bool CommitBindingTransaction(const bool bAllowKeyConflicts = false);
+
+	/**
+	*	Reverts every binding change made since the outermost BeginBindingTransaction
+	*/
+	UFUNCTION(BlueprintCallable, Category = "UINavController|Bindings")
+	void RollbackBindingTransaction();
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UINavController|Bindings")
+	FORCEINLINE bool IsInBindingTransaction() const { return BindingTransactionDepth > 0; }
+
+	/**
+	*	Replaces the key of one of an action's mappings.
+	*	Like a rebind made from an input box, a new mapping gets the negate and swizzle modifiers for the action's axis and direction.
+	*
+	*	@param InputContext The context that holds the mapping
+	*	@param ActionData The mapping's action, along with the axis and direction it's rebound for
+	*	@param OldKey The mapping's current key. If invalid, a new mapping is added
+	*	@param NewKey The new key. If invalid, the mapping is removed
+	*	@return Whether the mappings changed
+	*/
+	UFUNCTION(BlueprintCallable, Category = "UINavController|Bindings")
+	bool RebindActionKey(UInputMappingContext* InputContext, const FInputContainerEnhancedActionData& ActionData, const FKey OldKey, const FKey NewKey);
+
+	// Must be called before modifying an input context's mappings, so that the changes can be rolled back
+	void NotifyMappingContextModified(UInputMappingContext* InputContext);
+
+	/**
+	*	Returns the given action's mappings in the context, along with their axis properties.
+	*	Indexing other contexts doesn't invalidate the returned view, but modifying this context does.
+	*/
+	TArrayView<const FIndexedActionMapping> GetIndexedActionMappings(const UInputMappingContext* InputContext, const UInputAction* Action) const;
+
+	// Changes the key of one of the context's mappings, updating the context's action index in place
+	void SetMappingKey(UInputMappingContext* InputContext, const int32 MappingIndex, const FKey& NewKey);
+
+	// Adds a mapping to the context. Mapping indices change, so the context's action index is discarded
+	FEnhancedActionKeyMapping& MapContextKey(UInputMappingContext* InputContext, const UInputAction* Action, const FKey& Key);
+
+	// Removes the action's mappings to the key from the context. Mapping indices change, so the context's action index is discarded
+	void UnmapContextKey(UInputMappingContext* InputContext, const UInputAction* Action, const FKey& Key);
+
+	/**
+	*	Returns this player's copy of the given input context, or the context itself if the player hasn't modified it.
+	*	Use this when adding rebindable contexts to the player's Enhanced Input subsystem.
+	*	The player's copies only replace the original contexts already in the subsystem when the bindings change,
+	*	so adding an original context directly afterwards uses its default keys until the next rebind. Use AddPlayerInputContext,
+	*	RemovePlayerInputContext and HasPlayerInputContext instead of the subsystem's functions.
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UINavController|Bindings")
+	UInputMappingContext* GetPlayerInputContext(UInputMappingContext* InputContext) const;
+
+	// Same as GetPlayerInputContext, for native code that only reads the context
+	const UInputMappingContext* GetConstPlayerInputContext(const UInputMappingContext* InputContext) const;
+
+	/**
+	*	Adds this player's copy of the given input context to their Enhanced Input subsystem,
+	*	or the context itself if the player hasn't modified it
+	*/
+	UFUNCTION(BlueprintCallable, Category = "UINavController|Bindings")
+	void AddPlayerInputContext(UInputMappingContext* InputContext, const int32 Priority = 0);
+
+	/**
+	*	Removes the given input context from this player's Enhanced Input subsystem, along with the player's copy of it.
+	*	Use this instead of RemoveMappingContext, which would leave the player's copy active.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "UINavController|Bindings")
+	void RemovePlayerInputContext(UInputMappingContext* InputContext);
+
+	/**
+	*	Returns whether the given input context, or the player's copy of it, is in this player's Enhanced Input subsystem.
+	*	Accepts either the original context or the copy.
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UINavController|Bindings")
+	bool HasPlayerInputContext(const UInputMappingContext* InputContext, int32& OutPriority) const;
+
+	/**
+	*	Returns this player's copy of the given input context, creating it if needed, so that
+	*	its mappings can be modified without affecting other players.
+	*/
+	UInputMappingContext* GetMutableInputContext(UInputMappingContext* InputContext);
+
+	/**
+	*	Restores the default mappings of the contexts this player modified, with a single mapping rebuild.
+	*	Only the actions whose mappings differ from the defaults are touched.
+	*
+	*	@param InputContext If not null, only this context is reset
+	*	@param Action If not null, only this action's mappings are reset
+	*	@param OutResetActions The actions whose mappings were reset
+	*/
+	void ResetBindingsToDefault(const UInputMappingContext* InputContext, const UInputAction* Action, TArray<const UInputAction*>& OutResetActions);
+
+	UFUNCTION(BlueprintCallable, Category = "UINavController|Bindings")
+	void ResetAllBindingsToDefault();
+
+	UFUNCTION(BlueprintCallable, Category = "UINavController|Bindings")
+	void ResetActionBindingsToDefault(UInputMappingContext* InputContext, const UInputAction* Action);
+
+	// Schedules the player's bindings to be saved, if enabled in the UINav settings
+	void MarkInputBindingsDirty();
+
+	// Adds a record to the navigation telemetry, if enabled in the UINav settings. Never allocates
+	FORCEINLINE void RecordTelemetry(const ENavigationTelemetryEvent Event, const FName Subject, const int32 Value = INDEX_NONE, const uint8 FromInputType = 0, const uint8 ToInputType = 0)
+	{
+		if (TelemetryBuffer.IsValid())
+		{
+			FNavigationTelemetryRecord Record;
+			Record.Cycles = FPlatformTime::Cycles64();
+			Record.Subject = Subject;
+			Record.Value = Value;
+			Record.Event = Event;
+			Record.FromInputType = FromInputType;
+			Record.ToInputType = ToInputType;
+			TelemetryBuffer->Write(Record);
+		}
+	}
+
+	/**
+	*	Passes the navigation telemetry recorded since the last drain to the callback, oldest first.
+	*	Returns false if telemetry is disabled or is being written to its file.
+	*/
+	bool DrainNavigationTelemetry(TFunctionRef<void(const FNavigationTelemetryRecord&)> Callback);
 		
 	void HandleKeyDownEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
 	void HandleKeyUpEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
@@ -439,6 +736,48 @@ public:
 	UFUNCTION(BlueprintCallable, Category = UINavWidget, meta = (AdvancedDisplay = 2))
 	UUINavWidget* GoToBuiltWidget(UUINavWidget* NewWidget, const bool bRemoveParent, const bool bDestroyParent = false, const int ZOrder = 0);
 
+	/**
+	*	Creates a widget of each of the given classes, builds its Slate widgets off-screen and gathers its nested widgets and components,
+	*	and keeps it until GoToWidget is called with its class, so that the class's first open doesn't pay for those.
+	*	Meant to be called during loading screens.
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavController)
+	void PrewarmWidgets(const TArray<TSubclassOf<UUINavWidget>>& WidgetClasses);
+
+	// Loads the widget classes in the UINav settings' PrewarmWidgetClasses and, if bPrewarmKeyIcons is set, the key icons in the background, then prewarms the widgets
+	void PrewarmConfiguredWidgets();
+
+	// Returns the prewarmed widget of the given class if there's one, or a newly created widget otherwise
+	UUINavWidget* CreateUINavWidget(TSubclassOf<UUINavWidget> WidgetClass);
+
+	/**
+	*	Saves the given widget's state on top of the navigation stack, so that returning to it can restore it.
+	*	Called when navigating from the widget to a new one.
+	*/
+	void PushNavigationStack(UUINavWidget* Widget);
+
+	/**
+	*	Removes the given widget's entry, and the entries above it, from the navigation stack
+	*
+	*	@return Whether the widget had an entry
+	*/
+	bool PopNavigationStack(const UUINavWidget* Widget, FNavigationStackEntry& OutEntry);
+
+	UFUNCTION(BlueprintCallable, Category = UINavController)
+	void ClearNavigationStack();
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavController)
+	FORCEINLINE TArray<FNavigationStackEntry> GetNavigationStack() const { return NavigationStack; }
+
+	// Queues the removal of a closed widget, to be done in a later frame within the UINav settings' WidgetTeardownBudget
+	void QueueWidgetTeardown(UUINavWidget* Widget);
+
+	// Removes a widget from the teardown queue. Returns whether it was queued
+	bool CancelWidgetTeardown(UUINavWidget* Widget);
+
+	// Removes queued widgets until this frame's teardown budget is spent
+	void ProcessTeardownQueue();
+
 	void NavigateInDirection(const EUINavigation Direction);
 	void MenuNext();
 	void MenuPrevious();
@@ -4,10 +4,13 @@
 
 #include "UObject/NoExportTypes.h"
 #include "GameFramework/PlayerInput.h"
+#include "Engine/EngineTypes.h"
 #include "InputMappingContext.h"
 #include "Data/UINavEnhancedInputActions.h"
 #include "UINavSettings.generated.h"
 
+class UUINavWidget;
+
 /**
  * 
  */
@@ -57,4 +60,78 @@ public:
 
 	UPROPERTY(config, EditAnywhere, Category = "Settings")
 	TSoftObjectPtr<UUINavEnhancedInputActions> EnhancedInputActions = TSoftObjectPtr<UUINavEnhancedInputActions>(FSoftObjectPath("/UINavigation/Input/UINavEnhancedInputActions.UINavEnhancedInputActions"));
+
+	/*
+	* The Input Mapping Contexts used for rebinding and key queries.
+	* If this list isn't empty, the asset registry won't be searched and InputContextPaths and InputContextTags are ignored.
+	*/
+	UPROPERTY(config, EditAnywhere, Category = "Input Contexts")
+	TArray<TSoftObjectPtr<UInputMappingContext>> InputContexts;
+
+	// The content folders in which to search for Input Mapping Contexts. If empty, the whole project is searched
+	UPROPERTY(config, EditAnywhere, Category = "Input Contexts", meta = (ContentDir))
+	TArray<FDirectoryPath> InputContextPaths;
+
+	// If not empty, only Input Mapping Contexts with at least one of these asset registry tags will be used
+	UPROPERTY(config, EditAnywhere, Category = "Input Contexts")
+	TArray<FName> InputContextTags;
+
+	// Whether the Input Mapping Contexts should be loaded asynchronously instead of blocking the game thread on BeginPlay
+	UPROPERTY(config, EditAnywhere, Category = "Input Contexts")
+	bool bLoadInputContextsAsync = true;
+
+	// The widget classes that each player prewarms on BeginPlay, so that opening them the first time isn't slower than later
+	UPROPERTY(config, EditAnywhere, Category = "Prewarming")
+	TArray<TSoftClassPtr<UUINavWidget>> PrewarmWidgetClasses;
+
+	/*
+	* Whether the key icons in the PC component's icon data tables should be loaded on BeginPlay, whether or not there are widget classes to prewarm.
+	* The icons then stay loaded for the whole session.
+	*/
+	UPROPERTY(config, EditAnywhere, Category = "Prewarming")
+	bool bPrewarmKeyIcons = false;
+
+	// Whether each player's rebound keys should be saved to a file when they change, and loaded when the game starts
+	UPROPERTY(config, EditAnywhere, Category = "Input Bindings")
+	bool bSaveInputBindings = false;
+
+	// The time, in seconds, to wait after the last binding change before saving, so that consecutive changes are written only once
+	UPROPERTY(config, EditAnywhere, Category = "Input Bindings", meta = (EditCondition = "bSaveInputBindings", ClampMin = "0.0"))
+	float InputBindingsSaveDelay = 1.0f;
+
+	// Whether navigation events (navigations, opened widgets, back-outs, input type changes and rebinds) should be recorded
+	UPROPERTY(config, EditAnywhere, Category = "Telemetry")
+	bool bRecordNavigationTelemetry = false;
+
+	// The maximum number of records kept before they're drained. Records made while the buffer is full are dropped
+	UPROPERTY(config, EditAnywhere, Category = "Telemetry", meta = (EditCondition = "bRecordNavigationTelemetry", ClampMin = "2"))
+	int32 NavigationTelemetryCapacity = 4096;
+
+	// Whether the records should be periodically appended to a file in the Saved folder, instead of only being drained on demand
+	UPROPERTY(config, EditAnywhere, Category = "Telemetry", meta = (EditCondition = "bRecordNavigationTelemetry"))
+	bool bWriteNavigationTelemetryToFile = true;
+
+	// The time, in seconds, between writes of the records to the file
+	UPROPERTY(config, EditAnywhere, Category = "Telemetry", meta = (EditCondition = "bRecordNavigationTelemetry && bWriteNavigationTelemetryToFile", ClampMin = "0.1"))
+	float NavigationTelemetryFlushInterval = 10.0f;
+
+	// The maximum number of widgets each player's navigation stack remembers. Older entries are forgotten and set up again when returned to. 0 disables the stack, so that returning to a widget sets it up again as before
+	UPROPERTY(config, EditAnywhere, Category = "Navigation Stack", meta = (ClampMin = "0"))
+	int32 MaxNavigationStackDepth = 0;
+
+	// The maximum number of removed widgets in the navigation stack whose Slate widgets are kept. Older ones only keep their state and are rebuilt when returned to
+	UPROPERTY(config, EditAnywhere, Category = "Navigation Stack", meta = (EditCondition = "MaxNavigationStackDepth > 0", ClampMin = "0"))
+	int32 MaxRetainedStackWidgets = 4;
+
+	// Whether widgets closed by returning to their parent should be hidden right away and removed over the following frames, instead of all in the frame they're closed
+	UPROPERTY(config, EditAnywhere, Category = "Teardown")
+	bool bDeferWidgetTeardown = false;
+
+	// The time, in milliseconds, spent removing closed widgets each frame. At least one widget is removed per frame
+	UPROPERTY(config, EditAnywhere, Category = "Teardown", meta = (EditCondition = "bDeferWidgetTeardown", ClampMin = "0.0"))
+	float WidgetTeardownBudget = 1.0f;
+
+	// The time, in milliseconds, spent setting up components each frame in widgets with time-sliced setup
+	UPROPERTY(config, EditAnywhere, Category = "Setup", meta = (ClampMin = "0.0"))
+	float SetupTimeSliceBudget = 2.0f;
 };
@@ -8,7 +8,10 @@
 #include "Data/SelectorPosition.h"
 #include "Data/NavigationEvent.h"
 #include "Data/ThumbstickAsMouse.h"
+#include "Data/UINavComponentRegistry.h"
+#include "Data/UINavWidgetState.h"
 #include "Delegates/DelegateCombinations.h"
+#include "Misc/Optional.h"
 #include "UObject/Object.h"
 #include "UINavWidget.generated.h"
 
@@ -16,6 +19,8 @@ class UUINavComponent;
 class UUINavHorizontalComponent;
 class UUINavPromptWidget;
 class UPromptDataBase;
+class UPanelWidget;
+class UUINavLazyWidget;
 enum class EButtonStyle : uint8;
 
 DECLARE_DYNAMIC_DELEGATE_OneParam(FPromptWidgetDecided, const UPromptDataBase*, PromptData);
@@ -44,15 +49,65 @@ protected:
 	bool bReturningToParent = false;
 
 	bool bDestroying = false;
+
+	// Whether Destruct should be called when this widget's deferred teardown finishes
+	bool bDestructOnTeardown = false;
+
+	ESlateVisibility VisibilityBeforeTeardown = ESlateVisibility::Visible;
+
+	// Whether this widget's Slate widgets are being built off-screen by Prewarm
+	bool bPrewarming = false;
+
+	// Keeps the Slate widgets built by Prewarm alive until this widget is added to the screen
+	TSharedPtr<SWidget> PrewarmedSlateWidget;
 	bool bHasNavigation = false;
 	bool bForcingNavigation = true;
 	bool bRestoreNavigation = false;
 
 	bool bHoverRestoredNavigation = false;
 
+	// Whether this widget is already in its outer widget's ChildUINavWidgets
+	bool bRegisteredInOuter = false;
+
+	int32 ComponentBatchDepth = 0;
+
+	// The components constructed during the current component batch
+	UPROPERTY()
+	TArray<UUINavComponent*> BatchedComponents;
+
+	bool bBatchRemovedFirstComponent = false;
+
+	// The components waiting to be set up, when this widget's setup is time-sliced
+	UPROPERTY()
+	TArray<UUINavComponent*> PendingSetupComponents;
+
+	// The number of components at the start of PendingSetupComponents that were already handled
+	int32 NumHandledSetupComponents = 0;
+
+	// The lazy nested widget placeholders in this widget's tree, built or not
+	UPROPERTY()
+	TArray<UUINavLazyWidget*> LazyWidgets;
+
+	// The state to restore when this widget finishes its setup
+	TOptional<FUINavWidgetState> PendingWidgetState;
+
+	/*
+	The widgets of this widget's navigation state, gathered on the first capture or restore.
+	Kept until components, nested widgets or built lazy widgets are added to or removed from this widget or its nested widgets.
+	*/
+	UPROPERTY()
+	FUINavStateWidgets CachedStateWidgets;
+
+	bool bStateWidgetsCached = false;
+
 	UPROPERTY(BlueprintReadOnly, Category = UINavWidget)
 	UUINavComponent* FirstComponent = nullptr;
 
+	// The components of this widget and its nested widgets. Only used by the outermost widget,
+	// nested widgets hand theirs over once they know their outer widget
+	UPROPERTY()
+	FUINavComponentRegistry ComponentRegistry;
+
 	UPROPERTY(BlueprintReadOnly, Category = "UINavWidget")
 	UUINavComponent* CurrentComponent = nullptr;
 
@@ -95,6 +150,38 @@ protected:
 	*/
 	void CleanSetup();
 
+	/**
+	*	Marks this widget and its nested widgets as set up again without waiting for their geometry,
+	*	as they kept their state since they were last set up
+	*/
+	void ResumeSetup();
+
+	/**
+	*	Finishes the setup of a widget that was already set up, restoring its pending state
+	*	instead of reconfiguring it and waiting for its geometry
+	*/
+	void ResumeSetupFromPendingState();
+
+	/**
+	*	Applies the given state to this widget and its nested widgets
+	*
+	*	@return The component that should be focused
+	*/
+	UUINavComponent* ApplyWidgetState(const FUINavWidgetState& State);
+
+	/**
+	*	Sets up the first component and the initially focused component along with its neighbours,
+	*	leaving the remaining pending components to be set up over the following frames
+	*/
+	void SetupInitialComponents();
+
+	/**
+	*	Sets up pending components until this frame's time slice budget is spent
+	*/
+	void SetupPendingComponents();
+
+	void SetupPendingComponent(const int32 Index);
+
 	/**
 	*	Configures the UINavPC
 	*/
@@ -181,6 +268,15 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = UINavWidget)
 	bool bForceUsePlayerScreen = false;
 
+	/*
+	* If set to true, this widget's first setup only sets up the initially focused component and its neighbours,
+	* and sets up the remaining components over the following frames, within the UINav settings' SetupTimeSliceBudget.
+	* Meant for widgets with a very large amount of components.
+	* Only used by outermost widgets, nested widgets' components are always set up along with the outer widget's.
+	*/
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = UINavWidget)
+	bool bTimeSliceSetup = false;
+
 	bool bCompletedSetup = false;
 	bool bSetupStarted = false;
 
@@ -200,6 +296,10 @@ public:
 
 	
 	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
+
+	// The construction steps of an outermost widget added to the screen
+	void SetupOutermostWidget();
 
 	virtual FReply NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent) override;
 	virtual FReply NativeOnKeyUp(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent) override;
@@ -220,6 +320,23 @@ public:
 	*	Reconfigures the blueprint if it has already been setup
 	*/
 	void ReconfigureSetup();
+
+	/**
+	*	Returns the navigation state of this widget and its nested widgets: focused component, each widget's current component,
+	*	scroll offsets, horizontal component values and selector position
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavWidget)
+	FUINavWidgetState CaptureWidgetState();
+
+	// Returns the widgets of this widget's navigation state, gathering them if they aren't cached
+	const FUINavStateWidgets& GetStateWidgets();
+
+	/**
+	*	Restores a state captured from a widget of this class.
+	*	If this widget isn't set up yet, the state is restored when it is, without waiting for the geometry to place the selector.
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavWidget)
+	void RestoreWidgetState(const FUINavWidgetState& State);
 	
 	/**
 	*	Called manually to setup all the elements in the Widget
@@ -477,18 +594,74 @@ public:
 
 	UUINavWidget* GetChildUINavWidget(const int ChildIndex) const;
 
-	FORCEINLINE TArray<int> GetUINavWidgetPath() const { return UINavWidgetPath; }
+	FORCEINLINE const TArray<int>& GetUINavWidgetPath() const { return UINavWidgetPath; }
 
 	EThumbstickAsMouse GetUseThumbstickAsMouse() const;
 
 	void AddParentToPath(const int IndexInParent);
 
+	// Removes the first entries of the path of this widget and of its nested widgets
+	void RemoveParentsFromPath(const int NumParents);
+
+	// Decrements the index at the given position in the path of this widget and of its nested widgets
+	void DecrementPathIndex(const int PathPosition);
+
+	// Adds a nested widget to ChildUINavWidgets, if it wasn't already
+	void RegisterChildUINavWidget(UUINavWidget* ChildUINavWidget);
+
+	// Removes a nested widget that was removed at runtime from ChildUINavWidgets, and fixes the paths of the remaining ones
+	void UnregisterChildUINavWidget(UUINavWidget* ChildUINavWidget);
+
+	// Discards the cached state widgets of this widget and of its outer widgets, whose cached widgets include this widget's
+	void InvalidateStateWidgets();
+
+	/**
+	*	Defers the registration, first component, focus and selector updates of the components added to or removed from
+	*	this widget and its nested widgets until EndComponentBatch, so that they're done in a single pass.
+	*	Batches can be nested, only the outermost EndComponentBatch call applies them.
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavWidget)
+	void BeginComponentBatch();
+
+	UFUNCTION(BlueprintCallable, Category = UINavWidget)
+	void EndComponentBatch();
+
+	// Adds the components to the given panel in a single component batch
+	UFUNCTION(BlueprintCallable, Category = UINavWidget)
+	void AddComponents(UPanelWidget* Panel, const TArray<UUINavComponent*>& Components);
+
+	// Returns this widget or the outer widget with a component batch in progress, or nullptr if there's none
+	UUINavWidget* GetComponentBatchOwner();
+
+	FORCEINLINE void DeferComponentConstruct(UUINavComponent* Component) { BatchedComponents.Add(Component); }
+
+	/**
+	*	Queues the given component's setup if this widget's setup is time-sliced and hasn't completed yet
+	*
+	*	@return Whether the component's setup was queued
+	*/
+	bool DeferComponentSetup(UUINavComponent* Component);
+
+	FORCEINLINE void RegisterLazyWidget(UUINavLazyWidget* LazyWidget) { LazyWidgets.AddUnique(LazyWidget); }
+
+	/**
+	*	Builds the nested widgets of the lazy widget placeholders in this widget and in its nested widgets,
+	*	so that navigating to them later doesn't need to build them
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavWidget)
+	void PrefetchLazyWidgets();
+
 	UUINavComponent* GetFirstComponent() const { return FirstComponent; }
 
 	void SetFirstComponent(UUINavComponent* Component);
 
 	void RemovedComponent(UUINavComponent* Component);
 
+	// Adds the component to the outermost widget's component registry
+	void RegisterComponent(UUINavComponent* Component);
+
+	FORCEINLINE FUINavComponentRegistry& GetComponentRegistry() { return ComponentRegistry; }
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavWidget)
 	bool IsSelectorValid();
 
@@ -536,6 +709,37 @@ public:
 
 	void RemoveAllParents();
 
+	/**
+	*	Removes this widget from the viewport after it's closed.
+	*	If widget teardown is deferred, it's only hidden and its removal is queued in the UINavPC.
+	*/
+	void Teardown(const bool bDestruct);
+
+	/**
+	*	Removes this widget from the viewport once its turn in the UINavPC's teardown queue comes
+	*/
+	void FinishTeardown();
+
+	/**
+	*	Takes this widget out of the UINavPC's teardown queue if it's reopened before its turn, restoring its visibility.
+	*	If it's still in the viewport and bRemoveFromViewport is true, it's removed right away so that it's constructed again when added back.
+	*	Returns whether the widget was queued.
+	*/
+	bool CancelTeardown(const bool bRemoveFromViewport);
+
+	/**
+	*	Builds this widget's Slate widgets off-screen and gathers its nested widgets and components,
+	*	without setting it up or taking the player's focus, so that its first open doesn't pay for them
+	*/
+	void Prewarm();
+
+	/**
+	*	Called after a prewarmed widget is added to the screen. Its Slate widgets aren't rebuilt, so it isn't constructed again,
+	*	and the setup steps skipped by Prewarm are run here instead.
+	*	If nothing took the prewarmed Slate widgets, they're released and the widget is constructed normally once it's built.
+	*/
+	void FinishPrewarm();
+
 	int GetWidgetHierarchyDepth(UWidget* Widget) const;
 
 	FORCEINLINE bool HasNavigation() const { return bHasNavigation; }
@@ -4,10 +4,12 @@
 
 #include "Framework/Application/NavigationConfig.h" // from Slate
 
+class UInputMappingContext;
+
 class UINAVIGATION_API FUINavigationConfig : public FNavigationConfig
 {
 public:
-	FUINavigationConfig(const bool bAllowAccept = true, const bool bAllowBack = true, const bool bUseAnalogDirectionalInput = true, const bool bUsingThumbstickAsMouse = false);
+	FUINavigationConfig(const bool bAllowAccept = true, const bool bAllowBack = true, const bool bUseAnalogDirectionalInput = true, const bool bUsingThumbstickAsMouse = false, const UInputMappingContext* PlayerInputContext = nullptr);
 
 	virtual EUINavigationAction GetNavigationActionForKey(const FKey& InKey) const override;
 